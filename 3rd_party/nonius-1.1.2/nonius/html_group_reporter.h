@@ -61,6 +61,17 @@ namespace nonius {
         place_legend_below = enable;
     }
 
+    // calls 'func(title, group_name, benchmark_name, analysis)' for every finished benchmark
+    template<typename Func>
+    void visit_results(Func&& func) const {
+        for (const auto& bench_group : m_all_benchmarks) {
+            for (const auto& bench : bench_group.second) {
+                if (!bench.second.m_sample_data.empty())
+                    func(title, bench_group.first.title, bench.first, bench.second.m_analysis);
+            }
+        }
+    }
+
     void generate_report() const {
 
         const std::string file_name = gen_unique_filename(m_output_file_path);
@@ -87,8 +98,13 @@ namespace nonius {
             benchmark_group["title_tooltip"] = escape(bench_group.first.tooltip);
             benchmark_group["unit"] = detail::units_for_magnitude(samples_magnitude);
             cpptempl::data_map bench_list_data;
+            bool has_data = false;
 
             for(const auto& bench_list : bench_group.second) {
+                // a failed benchmark has no samples; it would break the 'times' list of the template
+                if (bench_list.second.m_sample_data.empty())
+                    continue;
+
                 cpptempl::data_map benchmark_data;
                 benchmark_data["name"]              = escape(bench_list.first);
                 benchmark_data["mean"]              = bench_list.second.m_analysis.mean.point.count() * mean_magnitude;
@@ -117,8 +133,10 @@ namespace nonius {
                     benchmark_data["times"].push_back(e.count() * samples_magnitude);
                 }
                 benchmark_group["data"].push_back(benchmark_data);
+                has_data = true;
             }
-             map["benchmark_groups"].push_back(benchmark_group);
+            if (has_data)
+                map["benchmark_groups"].push_back(benchmark_group);
         }
 
         std::ofstream ofs(file_name);
@@ -1328,8 +1328,6 @@ namespace nonius {
 
 #define NONIUS_DETAIL_ANALYSIS_HPP
 
-#include <boost/math/distributions/normal.hpp>
-
 #include <algorithm>
 #include <functional>
 #include <iterator>
@@ -1339,6 +1337,7 @@ namespace nonius {
 #include <numeric>
 #include <tuple>
 #include <cmath>
+#include <limits>
 #include <utility>
 #include <future>
 #include <cstddef>
@@ -1434,10 +1433,45 @@ namespace nonius {
             return results;
         }
 
+        inline double normal_cdf(double x) {
+            return std::erfc(-x / std::sqrt(2.0)) / 2.0;
+        }
+
+        // rational approximation of P. J. Acklam, refined with one step of Halley's method
+        inline double normal_quantile(double p) {
+            static const double a[] = { -3.969683028665376e+01,  2.209460984245205e+02, -2.759285104469687e+02,
+                                         1.383577518672690e+02, -3.066479806614716e+01,  2.506628277459239e+00 };
+            static const double b[] = { -5.447609879822406e+01,  1.615858368580409e+02, -1.556989798598866e+02,
+                                         6.680131188771972e+01, -1.328068155288572e+01 };
+            static const double c[] = { -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                                        -2.549732539343734e+00,  4.374664141464968e+00,  2.938163982698783e+00 };
+            static const double d[] = {  7.784695709041462e-03,  3.224671290700398e-01,  2.445134137142996e+00,
+                                         3.754408661907416e+00 };
+            static const double p_low = 0.02425;
+
+            if(p <= 0.) return -std::numeric_limits<double>::infinity();
+            if(p >= 1.) return std::numeric_limits<double>::infinity();
+
+            double x;
+            if(p < p_low) {
+                double q = std::sqrt(-2 * std::log(p));
+                x = (((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5]) / ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1);
+            } else if(p <= 1 - p_low) {
+                double q = p - 0.5;
+                double r = q * q;
+                x = (((((a[0]*r+a[1])*r+a[2])*r+a[3])*r+a[4])*r+a[5])*q / (((((b[0]*r+b[1])*r+b[2])*r+b[3])*r+b[4])*r+1);
+            } else {
+                double q = std::sqrt(-2 * std::log(1 - p));
+                x = -(((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5]) / ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1);
+            }
+
+            double e = normal_cdf(x) - p;
+            double u = e * std::sqrt(2 * 3.14159265358979323846) * std::exp(x * x / 2);
+            return x - u / (1 + x * u / 2);
+        }
+
         template <typename Iterator, typename Estimator>
         estimate<double> bootstrap(double confidence_level, Iterator first, Iterator last, sample const& resample, Estimator&& estimator) {
-            namespace bm = boost::math;
-
             auto n_samples = last - first;
 
             double point = estimator(first, last);
@@ -1460,10 +1494,10 @@ namespace nonius {
             // degenerate case with uniform samples
             if(prob_n == 0) return { point, point, point, confidence_level };
 
-            double bias = bm::quantile(bm::normal{}, prob_n);
-            double z1 = bm::quantile(bm::normal{}, (1. - confidence_level) / 2.);
+            double bias = normal_quantile(prob_n);
+            double z1 = normal_quantile((1. - confidence_level) / 2.);
 
-            auto cumn = [n](double x) -> int { return std::lround(bm::cdf(bm::normal{}, x) * n); };
+            auto cumn = [n](double x) -> int { return std::lround(normal_cdf(x) * n); };
             auto a = [bias, accel](double b) { return bias + b / (1. - accel * b); };
             double b1 = bias + z1;
             double b2 = bias - z1;
@@ -2183,15 +2217,58 @@ namespace nonius {
 #include <map>
 #include <memory>
 #include <unordered_map>
-#include <boost/lexical_cast.hpp>
+#include <cctype>
+#include <iomanip>
+#include <type_traits>
 
 #include <ostream>
 
 #include <sstream>
-#include <boost/algorithm/string.hpp>
 
 namespace cpptempl
 {
+    // string helpers, which replace boost::lexical_cast and boost/algorithm/string
+    template<typename T>
+    inline std::string to_string(const T& data) {
+        std::ostringstream stream;
+        if (std::is_floating_point<T>::value) stream << std::setprecision(17);
+        stream << data;
+        return stream.str();
+    }
+
+    template<typename Predicate>
+    inline std::string trim_copy_if(const std::string& text, Predicate pred) {
+        std::string::size_type first = 0;
+        std::string::size_type last = text.size();
+        while (first < last && pred(text[first])) ++first;
+        while (last > first && pred(text[last - 1])) --last;
+        return text.substr(first, last - first);
+    }
+
+    inline bool is_space(char c) {
+        return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+
+    inline std::string trim_copy(const std::string& text) {
+        return trim_copy_if(text, is_space);
+    }
+
+    inline void split(std::vector<std::string>& elements, const std::string& text) {
+        elements.clear();
+        std::string::size_type start = 0;
+        for (std::string::size_type pos = 0; pos < text.size(); ++pos) {
+            if (is_space(text[pos])) {
+                elements.push_back(text.substr(start, pos - start));
+                start = pos + 1;
+            }
+        }
+        elements.push_back(text.substr(start));
+    }
+
+    inline bool starts_with(const std::string& text, const std::string& prefix) {
+        return text.compare(0, prefix.size(), prefix) == 0;
+    }
+
     // various typedefs
 
     // data classes
@@ -2238,7 +2315,7 @@ namespace cpptempl
     template<> void data_ptr::operator = (const data_map& data);
     template<typename T>
     void data_ptr::operator = (const T& data) {
-        std::string data_str = boost::lexical_cast<std::string>(data);
+        std::string data_str = cpptempl::to_string(data);
         this->operator =(data_str);
     }
 
@@ -2499,7 +2576,7 @@ namespace cpptempl
         // quoted string
         if (key[0] == '\"')
         {
-            return make_data(boost::trim_copy_if(key, [](char c){ return c == '"'; }));
+            return make_data(trim_copy_if(key, [](char c){ return c == '"'; }));
         }
         // check for dotted notation, i.e [foo.bar]
         size_t index = key.find(".") ;
@@ -2562,7 +2639,7 @@ namespace cpptempl
     inline TokenFor::TokenFor(std::string expr)
     {
         std::vector<std::string> elements ;
-        boost::split(elements, expr, boost::is_space()) ;
+        split(elements, expr) ;
         if (elements.size() != 4u)
         {
             throw TemplateException("Invalid syntax in for statement") ;
@@ -2583,8 +2660,8 @@ namespace cpptempl
         for (size_t i = 0 ; i < items.size() ; ++i)
         {
             data_map loop ;
-            loop["index"] = make_data(boost::lexical_cast<std::string>(i+1)) ;
-            loop["index0"] = make_data(boost::lexical_cast<std::string>(i)) ;
+            loop["index"] = make_data(cpptempl::to_string(i+1)) ;
+            loop["index0"] = make_data(cpptempl::to_string(i)) ;
             data["loop"] = make_data(loop);
             data[m_val] = items[i] ;
             for(size_t j = 0 ; j < m_children.size() ; ++j)
@@ -2624,7 +2701,7 @@ namespace cpptempl
     inline bool TokenIf::is_true( std::string expr, data_map &data )
     {
         std::vector<std::string> elements ;
-        boost::split(elements, expr, boost::is_space()) ;
+        split(elements, expr) ;
 
         if (elements[1] == "not")
         {
@@ -2749,19 +2826,19 @@ namespace cpptempl
                 pos = text.find("}") ;
                 if (pos != std::string::npos)
                 {
-                    std::string expression = boost::trim_copy(text.substr(1, pos-2)) ;
+                    std::string expression = trim_copy(text.substr(1, pos-2)) ;
                     text = text.substr(pos+1) ;
-                    if (boost::starts_with(expression, "for"))
+                    if (starts_with(expression, "for"))
                     {
                         tokens.push_back(token_ptr (new TokenFor(expression))) ;
                     }
-                    else if (boost::starts_with(expression, "if"))
+                    else if (starts_with(expression, "if"))
                     {
                         tokens.push_back(token_ptr (new TokenIf(expression))) ;
                     }
                     else
                     {
-                        tokens.push_back(token_ptr (new TokenEnd(boost::trim_copy(expression)))) ;
+                        tokens.push_back(token_ptr (new TokenEnd(trim_copy(expression)))) ;
                     }
                 }
             }
@@ -75,6 +75,13 @@ endif()
 
 enable_rtti(BUILD_WITH_RTTI)
 
+if (BUILD_WITH_HOT_PATH_COUNTERS)
+  set(RTTR_HOT_PATH_COUNTERS 1)
+  message(STATUS "Hot path counters: enabled")
+else()
+  set(RTTR_HOT_PATH_COUNTERS 0)
+endif()
+
 if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
   if(CMAKE_CXX_COMPILER_VERSION VERSION_LESS "4.7.0")
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -std=c++0x")
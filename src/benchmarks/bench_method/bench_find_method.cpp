@@ -33,6 +33,8 @@
 #include <nonius/nonius.h++>
 #include <nonius/html_group_reporter.h>
 
+#include "benchmarks/common/bench_driver.h"
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -908,4 +910,5 @@ void bench_find_method()
     nonius::go(cfg, std::begin(benchmarks_group_6_neg), std::end(benchmarks_group_6_neg), reporter);
 
     reporter.generate_report();
+    bench::add_results(reporter);
 }
@@ -0,0 +1,224 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include "benchmarks/bench_method/test_methods.h"
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include "benchmarks/common/bench_driver.h"
+
+#include <string>
+#include <unordered_map>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::unordered_map<std::string, rttr::type> create_native_type_map()
+{
+    std::unordered_map<std::string, rttr::type> type_map;
+    for (const auto& t : rttr::type::get_types())
+        type_map.insert(std::make_pair(t.get_name().to_string(), t));
+
+    return type_map;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_find_type_hit()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        const auto type_map = create_native_type_map();
+        const std::string name = "ns_foo::method_class_d_6";
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (type_map.find(name) != type_map.end())
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_find_type_hit()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        const rttr::string_view name = "ns_foo::method_class_d_6";
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (rttr::type::get_by_name(name))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_find_type_hit_literal()
+{
+    return nonius::benchmark("rttr - string literal", [](nonius::chronometer meter)
+    {
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (rttr::type::get_by_name("ns_foo::method_class_d_6"))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_find_type_miss()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        const auto type_map = create_native_type_map();
+        const std::string name = "ns_foo::method_class_d_8";
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (type_map.find(name) != type_map.end())
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_find_type_miss()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        const rttr::string_view name = "ns_foo::method_class_d_8";
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (rttr::type::get_by_name(name))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_find_type_miss_literal()
+{
+    return nonius::benchmark("rttr - string literal", [](nonius::chronometer meter)
+    {
+        volatile std::size_t value = 0;
+        meter.measure([&]()
+        {
+            if (rttr::type::get_by_name("ns_foo::method_class_d_8"))
+            {
+                value = 1;
+            }
+            return value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_find_type()
+{
+    nonius::configuration cfg;
+    cfg.title = "find type by name";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_find_type.html");
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("type::get_by_name - hit", "benchmark code:"
+                                                              "<pre>"
+                                                              "// native approach\n"
+                                                              "std::unordered_map<std::string, rttr::type> type_map = ...; // contains all registered types\n"
+                                                              "if (type_map.find(\"ns_foo::method_class_d_6\") != type_map.end())\n"
+                                                              "    return true;\n"
+                                                              "\n"
+                                                              "// rttr approach\n"
+                                                              "if (rttr::type::get_by_name(\"ns_foo::method_class_d_6\"))\n"
+                                                              "    return true;\n"
+                                                              "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_native_find_type_hit(),
+                                               bench_rttr_find_type_hit(),
+                                               bench_rttr_find_type_hit_literal()};
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("type::get_by_name - miss", "benchmark code:"
+                                                               "<pre>"
+                                                               "// native approach\n"
+                                                               "std::unordered_map<std::string, rttr::type> type_map = ...; // contains all registered types\n"
+                                                               "if (type_map.find(\"ns_foo::method_class_d_8\") != type_map.end())\n"
+                                                               "    return true;\n"
+                                                               "\n"
+                                                               "// rttr approach\n"
+                                                               "if (rttr::type::get_by_name(\"ns_foo::method_class_d_8\"))\n"
+                                                               "    return true;\n"
+                                                               "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_native_find_type_miss(),
+                                               bench_rttr_find_type_miss(),
+                                               bench_rttr_find_type_miss_literal()};
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    reporter.generate_report();
+    bench::add_results(reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
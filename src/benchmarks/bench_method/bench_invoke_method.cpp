@@ -33,6 +33,8 @@
 #include <nonius/nonius.h++>
 #include <nonius/html_group_reporter.h>
 
+#include "benchmarks/common/bench_driver.h"
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -539,4 +541,5 @@ void bench_invoke_method()
     /////////////////////////////////////
 
     reporter.generate_report();
+    bench::add_results(reporter);
 }
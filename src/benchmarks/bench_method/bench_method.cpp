@@ -34,12 +34,14 @@
 #include <nonius/html_group_reporter.h>
 
 extern void bench_find_method();
+extern void bench_find_type();
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 void bench_method()
 {
     bench_find_method();
+    bench_find_type();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
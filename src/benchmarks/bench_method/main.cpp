@@ -25,14 +25,19 @@
 *                                                                                   *
 *************************************************************************************/
 
+#include "benchmarks/common/bench_driver.h"
+
 extern void bench_method();
 extern void bench_invoke_method();
 /////////////////////////////////////////////////////////////////////////////////////////
 
 int main(int argc, char** argv)
 {
-    bench_method();
-    bench_invoke_method();
+    return bench::run_benchmarks("bench_method", argc, argv, []()
+    {
+        bench_method();
+        bench_invoke_method();
+    });
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
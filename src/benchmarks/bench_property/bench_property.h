@@ -0,0 +1,120 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BENCH_PROPERTY_H_
+#define RTTR_BENCH_PROPERTY_H_
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+
+#if RTTR_COMPILER == RTTR_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Marks \p value as read and written by unknown code.
+ *
+ * The native property access is so cheap, that the compiler removes it from the measure loop
+ * when its result is unused; nonius aborts such a benchmark with "took too long to run".
+ */
+template<typename T>
+RTTR_FORCE_INLINE void keep_value(T& value)
+{
+#if RTTR_COMPILER == RTTR_COMPILER_MSVC
+    static const void* volatile sink = nullptr;
+    sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r"(&value) : "memory");
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Creates the native benchmark, which accesses an object of type \p T via \p func.
+ */
+template<typename T, typename F>
+nonius::benchmark bench_native(F func)
+{
+    return nonius::benchmark("native", [func](nonius::chronometer meter)
+    {
+        T obj;
+        keep_value(obj);
+        meter.measure([&]()
+        {
+            auto result = func(obj);
+            keep_value(result);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Creates the benchmark, which reads the property \p name of an object of type \p T.
+ */
+template<typename T>
+nonius::benchmark bench_rttr_get_value(const char* name, const char* bench_name = "rttr")
+{
+    return nonius::benchmark(bench_name, [name](nonius::chronometer meter)
+    {
+        T obj;
+        rttr::property prop = rttr::type::get(obj).get_property(name);
+        meter.measure([&]()
+        {
+            return prop.get_value(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Creates the benchmark, which writes \p value to the property \p name of an object of type \p T.
+ */
+template<typename T, typename Arg>
+nonius::benchmark bench_rttr_set_value(const char* name, Arg value, const char* bench_name = "rttr")
+{
+    return nonius::benchmark(bench_name, [name, value](nonius::chronometer meter)
+    {
+        T obj;
+        Arg arg = value;
+        rttr::property prop = rttr::type::get(obj).get_property(name);
+        meter.measure([&]()
+        {
+            return prop.set_value(obj, arg);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // RTTR_BENCH_PROPERTY_H_
@@ -0,0 +1,393 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+
+#include "benchmarks/bench_property/test_properties.h"
+#include "benchmarks/bench_property/bench_property.h"
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include "benchmarks/common/bench_driver.h"
+
+using namespace ns_foo;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_get_global_string()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        meter.measure([&]()
+        {
+            auto result = g_string_value;
+            keep_value(result);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_get_global(const char* name)
+{
+    return nonius::benchmark("rttr", [name](nonius::chronometer meter)
+    {
+        rttr::property prop = rttr::type::get_global_property(name);
+        meter.measure([&]()
+        {
+            return prop.get_value(rttr::instance());
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_get_global_int()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        meter.measure([&]()
+        {
+            auto result = g_int_value;
+            keep_value(result);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_set_global_int()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        meter.measure([&]()
+        {
+            g_int_value = 42;
+            keep_value(g_int_value);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_set_global_int()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        rttr::property prop = rttr::type::get_global_property("g_int_value");
+        int value = 42;
+        meter.measure([&]()
+        {
+            return prop.set_value(rttr::instance(), value);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_access()
+{
+    nonius::configuration cfg;
+    cfg.title = "property access";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_access.html");
+
+    // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
+    auto dummy_benchmark = nonius::benchmark_registry{bench_rttr_get_value<property_class>("int_value")};
+    nonius::go(cfg, dummy_benchmark);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("member object - int", "benchmark code:"
+                                                           "<pre>"
+                                                           "// native approach\n"
+                                                           "return obj.int_value;\n"
+                                                           "\n"
+                                                           "// rttr approach\n"
+                                                           "return prop.get_value(obj);\n"
+                                                           "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_native<property_class>([](property_class& obj) { return obj.int_value; }),
+                                               bench_rttr_get_value<property_class>("int_value") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("member object - std::string", "benchmark code:"
+                                                                   "<pre>"
+                                                                   "// native approach\n"
+                                                                   "return obj.string_value; // copy\n"
+                                                                   "\n"
+                                                                   "// rttr approach\n"
+                                                                   "return prop.get_value(obj);\n"
+                                                                   "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_native<property_class>([](property_class& obj) { return obj.string_value; }),
+                                               bench_rttr_get_value<property_class>("string_value") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("member object - std::vector<int>", "benchmark code:"
+                                                                        "<pre>"
+                                                                        "// native approach\n"
+                                                                        "return obj.vector_value; // copy of 100 elements\n"
+                                                                        "\n"
+                                                                        "// rttr approach\n"
+                                                                        "return prop.get_value(obj);\n"
+                                                                        "</pre>");
+    nonius::benchmark benchmarks_group_3[] = { bench_native<property_class>([](property_class& obj) { return obj.vector_value; }),
+                                               bench_rttr_get_value<property_class>("vector_value") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("member object - nested class", "benchmark code:"
+                                                                    "<pre>"
+                                                                    "// native approach\n"
+                                                                    "return obj.nested_value; // copy\n"
+                                                                    "\n"
+                                                                    "// rttr approach\n"
+                                                                    "return prop.get_value(obj);\n"
+                                                                    "</pre>");
+    nonius::benchmark benchmarks_group_4[] = { bench_native<property_class>([](property_class& obj) { return obj.nested_value; }),
+                                               bench_rttr_get_value<property_class>("nested_value") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("getter - int", "benchmark code:"
+                                                    "<pre>"
+                                                    "// native approach\n"
+                                                    "return obj.get_int_value();\n"
+                                                    "\n"
+                                                    "// rttr approach\n"
+                                                    "return prop.get_value(obj);\n"
+                                                    "</pre>");
+    nonius::benchmark benchmarks_group_5[] = { bench_native<property_class>([](property_class& obj) { return obj.get_int_value(); }),
+                                               bench_rttr_get_value<property_class>("int_func") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("getter - std::string", "benchmark code:"
+                                                            "<pre>"
+                                                            "// native approach\n"
+                                                            "return obj.get_string_value(); // copy\n"
+                                                            "\n"
+                                                            "// rttr approach\n"
+                                                            "return prop.get_value(obj);\n"
+                                                            "</pre>");
+    nonius::benchmark benchmarks_group_6[] = { bench_native<property_class>([](property_class& obj) { return obj.get_string_value(); }),
+                                               bench_rttr_get_value<property_class>("string_func") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("readonly - int", "benchmark code:"
+                                                      "<pre>"
+                                                      "// native approach\n"
+                                                      "return obj.int_value;\n"
+                                                      "\n"
+                                                      "// rttr approach\n"
+                                                      "return prop.get_value(obj); // registered with property_readonly()\n"
+                                                      "</pre>");
+    nonius::benchmark benchmarks_group_7[] = { bench_native<property_class>([](property_class& obj) { return obj.int_value; }),
+                                               bench_rttr_get_value<property_class>("int_readonly") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("global - int", "benchmark code:"
+                                                    "<pre>"
+                                                    "// native approach\n"
+                                                    "return g_int_value;\n"
+                                                    "\n"
+                                                    "// rttr approach\n"
+                                                    "return prop.get_value(rttr::instance());\n"
+                                                    "</pre>");
+    nonius::benchmark benchmarks_group_8[] = { bench_native_get_global_int(),
+                                               bench_rttr_get_global("g_int_value") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_8), std::end(benchmarks_group_8), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("global - std::string", "benchmark code:"
+                                                            "<pre>"
+                                                            "// native approach\n"
+                                                            "return g_string_value; // copy\n"
+                                                            "\n"
+                                                            "// rttr approach\n"
+                                                            "return prop.get_value(rttr::instance());\n"
+                                                            "</pre>");
+    nonius::benchmark benchmarks_group_9[] = { bench_native_get_global_string(),
+                                               bench_rttr_get_global("g_string_value") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("global readonly - int", "benchmark code:"
+                                                             "<pre>"
+                                                             "// native approach\n"
+                                                             "return g_int_value;\n"
+                                                             "\n"
+                                                             "// rttr approach\n"
+                                                             "return prop.get_value(rttr::instance()); // registered with property_readonly()\n"
+                                                             "</pre>");
+    nonius::benchmark benchmarks_group_10[] = { bench_native_get_global_int(),
+                                                bench_rttr_get_global("g_int_readonly") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_10), std::end(benchmarks_group_10), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set member object - int", "benchmark code:"
+                                                               "<pre>"
+                                                               "// native approach\n"
+                                                               "obj.int_value = 42;\n"
+                                                               "\n"
+                                                               "// rttr approach\n"
+                                                               "prop.set_value(obj, 42);\n"
+                                                               "</pre>");
+    nonius::benchmark benchmarks_group_11[] = { bench_native<property_class>([](property_class& obj) { obj.int_value = 42; return obj.int_value; }),
+                                                bench_rttr_set_value<property_class>("int_value", 42) };
+
+    nonius::go(cfg, std::begin(benchmarks_group_11), std::end(benchmarks_group_11), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set member object - std::string", "benchmark code:"
+                                                                       "<pre>"
+                                                                       "// native approach\n"
+                                                                       "obj.string_value = text;\n"
+                                                                       "\n"
+                                                                       "// rttr approach\n"
+                                                                       "prop.set_value(obj, text);\n"
+                                                                       "</pre>");
+    const std::string text = "another text, which does not fit in the small buffer";
+    nonius::benchmark benchmarks_group_12[] = { bench_native<property_class>([text](property_class& obj) { obj.string_value = text; return obj.string_value.size(); }),
+                                                bench_rttr_set_value<property_class>("string_value", text) };
+
+    nonius::go(cfg, std::begin(benchmarks_group_12), std::end(benchmarks_group_12), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set member object - std::vector<int>", "benchmark code:"
+                                                                            "<pre>"
+                                                                            "// native approach\n"
+                                                                            "obj.vector_value = vec; // 100 elements\n"
+                                                                            "\n"
+                                                                            "// rttr approach\n"
+                                                                            "prop.set_value(obj, vec);\n"
+                                                                            "</pre>");
+    const std::vector<int> vec(100, 2);
+    nonius::benchmark benchmarks_group_13[] = { bench_native<property_class>([vec](property_class& obj) { obj.vector_value = vec; return obj.vector_value.size(); }),
+                                                bench_rttr_set_value<property_class>("vector_value", vec) };
+
+    nonius::go(cfg, std::begin(benchmarks_group_13), std::end(benchmarks_group_13), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set member object - nested class", "benchmark code:"
+                                                                        "<pre>"
+                                                                        "// native approach\n"
+                                                                        "obj.nested_value = nested;\n"
+                                                                        "\n"
+                                                                        "// rttr approach\n"
+                                                                        "prop.set_value(obj, nested);\n"
+                                                                        "</pre>");
+    const nested_class nested;
+    nonius::benchmark benchmarks_group_14[] = { bench_native<property_class>([nested](property_class& obj) { obj.nested_value = nested; return obj.nested_value.id; }),
+                                                bench_rttr_set_value<property_class>("nested_value", nested) };
+
+    nonius::go(cfg, std::begin(benchmarks_group_14), std::end(benchmarks_group_14), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("setter - int", "benchmark code:"
+                                                    "<pre>"
+                                                    "// native approach\n"
+                                                    "obj.set_int_value(42);\n"
+                                                    "\n"
+                                                    "// rttr approach\n"
+                                                    "prop.set_value(obj, 42);\n"
+                                                    "</pre>");
+    nonius::benchmark benchmarks_group_15[] = { bench_native<property_class>([](property_class& obj) { obj.set_int_value(42); return obj.int_value; }),
+                                                bench_rttr_set_value<property_class>("int_func", 42) };
+
+    nonius::go(cfg, std::begin(benchmarks_group_15), std::end(benchmarks_group_15), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("setter - std::string", "benchmark code:"
+                                                            "<pre>"
+                                                            "// native approach\n"
+                                                            "obj.set_string_value(text);\n"
+                                                            "\n"
+                                                            "// rttr approach\n"
+                                                            "prop.set_value(obj, text);\n"
+                                                            "</pre>");
+    nonius::benchmark benchmarks_group_16[] = { bench_native<property_class>([text](property_class& obj) { obj.set_string_value(text); return obj.string_value.size(); }),
+                                                bench_rttr_set_value<property_class>("string_func", text) };
+
+    nonius::go(cfg, std::begin(benchmarks_group_16), std::end(benchmarks_group_16), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set global - int", "benchmark code:"
+                                                        "<pre>"
+                                                        "// native approach\n"
+                                                        "g_int_value = 42;\n"
+                                                        "\n"
+                                                        "// rttr approach\n"
+                                                        "prop.set_value(rttr::instance(), 42);\n"
+                                                        "</pre>");
+    nonius::benchmark benchmarks_group_17[] = { bench_native_set_global_int(),
+                                                bench_rttr_set_global_int() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_17), std::end(benchmarks_group_17), reporter);
+
+    /////////////////////////////////////
+
+    reporter.generate_report();
+    bench::add_results(reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
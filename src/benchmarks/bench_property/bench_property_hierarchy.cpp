@@ -0,0 +1,277 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+
+#include "benchmarks/bench_property/test_properties.h"
+#include "benchmarks/bench_property/bench_property.h"
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include "benchmarks/common/bench_driver.h"
+
+using namespace ns_foo;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_get_value_base_level_1()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        property_class_d_1 obj_1;
+        property_class_base& obj_base = obj_1;
+        keep_value(obj_1);
+        meter.measure([&]()
+        {
+            int result = 0;
+            if (property_class_d_1* obj = dynamic_cast<property_class_d_1*>(&obj_base))
+                result = obj->value_1;
+            keep_value(result);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_get_value_base_level_1()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        property_class_d_1 obj_1;
+        property_class_base& obj_base = obj_1;
+        rttr::property prop = rttr::type::get<property_class_d_1>().get_property("value_1");
+        meter.measure([&]()
+        {
+            return prop.get_value(obj_base);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_get_value_base_level_6()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        property_class_d_6 obj_6;
+        property_class_base& obj_base = obj_6;
+        keep_value(obj_6);
+        meter.measure([&]()
+        {
+            int result = 0;
+            if (property_class_d_6* obj = dynamic_cast<property_class_d_6*>(&obj_base))
+                result = obj->value_6;
+            keep_value(result);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_get_value_base_level_6()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        property_class_d_6 obj_6;
+        property_class_base& obj_base = obj_6;
+        rttr::property prop = rttr::type::get<property_class_d_6>().get_property("value_6");
+        meter.measure([&]()
+        {
+            return prop.get_value(obj_base);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_set_value_base_level_6()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        property_class_d_6 obj_6;
+        property_class_base& obj_base = obj_6;
+        keep_value(obj_6);
+        meter.measure([&]()
+        {
+            if (property_class_d_6* obj = dynamic_cast<property_class_d_6*>(&obj_base))
+                obj->value_6 = 42;
+            keep_value(obj_6.value_6);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_set_value_base_level_6()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        property_class_d_6 obj_6;
+        property_class_base& obj_base = obj_6;
+        rttr::property prop = rttr::type::get<property_class_d_6>().get_property("value_6");
+        int value = 42;
+        meter.measure([&]()
+        {
+            return prop.set_value(obj_base, value);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_hierarchy()
+{
+    nonius::configuration cfg;
+    cfg.title = "property access in class hierarchies";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_hierarchy.html");
+
+    // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
+    auto dummy_benchmark = nonius::benchmark_registry{bench_rttr_get_value<property_class_d_1>("value_1")};
+    nonius::go(cfg, dummy_benchmark);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("shallow - level 1", "benchmark code:"
+                                                         "<pre>"
+                                                         "// class hierarchy: base <- d_1\n"
+                                                         "property_class_d_1 obj;\n"
+                                                         "// native approach\n"
+                                                         "return obj.value_1;\n"
+                                                         "\n"
+                                                         "// rttr approach\n"
+                                                         "return prop.get_value(obj);\n"
+                                                         "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_native<property_class_d_1>([](property_class_d_1& obj) { return obj.value_1; }),
+                                               bench_rttr_get_value<property_class_d_1>("value_1") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("deep - level 6", "benchmark code:"
+                                                      "<pre>"
+                                                      "// class hierarchy: base <- d_1 <- ... <- d_6\n"
+                                                      "property_class_d_6 obj;\n"
+                                                      "// native approach\n"
+                                                      "return obj.value_6;\n"
+                                                      "\n"
+                                                      "// rttr approach\n"
+                                                      "return prop.get_value(obj);\n"
+                                                      "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_native<property_class_d_6>([](property_class_d_6& obj) { return obj.value_6; }),
+                                               bench_rttr_get_value<property_class_d_6>("value_6") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("deep - inherited from base", "benchmark code:"
+                                                                  "<pre>"
+                                                                  "// class hierarchy: base <- d_1 <- ... <- d_6\n"
+                                                                  "property_class_d_6 obj;\n"
+                                                                  "// native approach\n"
+                                                                  "return obj.value_0;\n"
+                                                                  "\n"
+                                                                  "// rttr approach\n"
+                                                                  "// the property is declared in the base class\n"
+                                                                  "return prop.get_value(obj);\n"
+                                                                  "</pre>");
+    nonius::benchmark benchmarks_group_3[] = { bench_native<property_class_d_6>([](property_class_d_6& obj) { return obj.value_0; }),
+                                               bench_rttr_get_value<property_class_d_6>("value_0") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("base instance - level 1", "benchmark code:"
+                                                               "<pre>"
+                                                               "property_class_d_1 obj_1;\n"
+                                                               "property_class_base& obj_base = obj_1;\n"
+                                                               "// native approach\n"
+                                                               "if (auto obj = dynamic_cast<property_class_d_1*>(&obj_base))\n"
+                                                               "    return obj->value_1;\n"
+                                                               "\n"
+                                                               "// rttr approach\n"
+                                                               "return prop.get_value(obj_base);\n"
+                                                               "</pre>");
+    nonius::benchmark benchmarks_group_4[] = { bench_native_get_value_base_level_1(),
+                                               bench_rttr_get_value_base_level_1() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("base instance - level 6", "benchmark code:"
+                                                               "<pre>"
+                                                               "property_class_d_6 obj_6;\n"
+                                                               "property_class_base& obj_base = obj_6;\n"
+                                                               "// native approach\n"
+                                                               "if (auto obj = dynamic_cast<property_class_d_6*>(&obj_base))\n"
+                                                               "    return obj->value_6;\n"
+                                                               "\n"
+                                                               "// rttr approach\n"
+                                                               "return prop.get_value(obj_base);\n"
+                                                               "</pre>");
+    nonius::benchmark benchmarks_group_5[] = { bench_native_get_value_base_level_6(),
+                                               bench_rttr_get_value_base_level_6() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set base instance - level 6", "benchmark code:"
+                                                                   "<pre>"
+                                                                   "property_class_d_6 obj_6;\n"
+                                                                   "property_class_base& obj_base = obj_6;\n"
+                                                                   "// native approach\n"
+                                                                   "if (auto obj = dynamic_cast<property_class_d_6*>(&obj_base))\n"
+                                                                   "    obj->value_6 = 42;\n"
+                                                                   "\n"
+                                                                   "// rttr approach\n"
+                                                                   "prop.set_value(obj_base, 42);\n"
+                                                                   "</pre>");
+    nonius::benchmark benchmarks_group_6[] = { bench_native_set_value_base_level_6(),
+                                               bench_rttr_set_value_base_level_6() };
+
+    nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
+
+    /////////////////////////////////////
+
+    reporter.generate_report();
+    bench::add_results(reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,140 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+
+#include "benchmarks/bench_property/test_properties.h"
+#include "benchmarks/bench_property/bench_property.h"
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include "benchmarks/common/bench_driver.h"
+
+#include <functional>
+
+using namespace ns_foo;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_policy()
+{
+    nonius::configuration cfg;
+    cfg.title = "property policies";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_policy.html");
+
+    // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
+    auto dummy_benchmark = nonius::benchmark_registry{bench_rttr_get_value<property_class>("vector_value_ptr")};
+    nonius::go(cfg, dummy_benchmark);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get std::vector<int>", "benchmark code:"
+                                                            "<pre>"
+                                                            "// native approach\n"
+                                                            "return &obj.vector_value;\n"
+                                                            "\n"
+                                                            "// rttr approach\n"
+                                                            "return prop.get_value(obj);     // copy of 100 elements\n"
+                                                            "return prop_ptr.get_value(obj); // policy::prop::bind_as_ptr\n"
+                                                            "return prop_ref.get_value(obj); // policy::prop::as_reference_wrapper\n"
+                                                            "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_native<property_class>([](property_class& obj) { return &obj.vector_value; }),
+                                               bench_rttr_get_value<property_class>("vector_value"),
+                                               bench_rttr_get_value<property_class>("vector_value_ptr", "rttr - bind_as_ptr"),
+                                               bench_rttr_get_value<property_class>("vector_value_ref", "rttr - as_reference_wrapper") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get nested class", "benchmark code:"
+                                                        "<pre>"
+                                                        "// native approach\n"
+                                                        "return &obj.nested_value;\n"
+                                                        "\n"
+                                                        "// rttr approach\n"
+                                                        "return prop.get_value(obj);     // copy\n"
+                                                        "return prop_ptr.get_value(obj); // policy::prop::bind_as_ptr\n"
+                                                        "return prop_ref.get_value(obj); // policy::prop::as_reference_wrapper\n"
+                                                        "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_native<property_class>([](property_class& obj) { return &obj.nested_value; }),
+                                               bench_rttr_get_value<property_class>("nested_value"),
+                                               bench_rttr_get_value<property_class>("nested_value_ptr", "rttr - bind_as_ptr"),
+                                               bench_rttr_get_value<property_class>("nested_value_ref", "rttr - as_reference_wrapper") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set std::vector<int>", "benchmark code:"
+                                                            "<pre>"
+                                                            "// native approach\n"
+                                                            "obj.vector_value = vec;\n"
+                                                            "\n"
+                                                            "// rttr approach\n"
+                                                            "prop.set_value(obj, vec);\n"
+                                                            "prop_ptr.set_value(obj, &vec);         // policy::prop::bind_as_ptr\n"
+                                                            "prop_ref.set_value(obj, std::ref(vec)); // policy::prop::as_reference_wrapper\n"
+                                                            "</pre>");
+    std::vector<int> vec(100, 2);
+    nonius::benchmark benchmarks_group_3[] = { bench_native<property_class>([&vec](property_class& obj) { obj.vector_value = vec; return obj.vector_value.size(); }),
+                                               bench_rttr_set_value<property_class>("vector_value", vec),
+                                               bench_rttr_set_value<property_class>("vector_value_ptr", &vec, "rttr - bind_as_ptr"),
+                                               bench_rttr_set_value<property_class>("vector_value_ref", std::ref(vec), "rttr - as_reference_wrapper") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set nested class", "benchmark code:"
+                                                        "<pre>"
+                                                        "// native approach\n"
+                                                        "obj.nested_value = nested;\n"
+                                                        "\n"
+                                                        "// rttr approach\n"
+                                                        "prop.set_value(obj, nested);\n"
+                                                        "prop_ptr.set_value(obj, &nested);         // policy::prop::bind_as_ptr\n"
+                                                        "prop_ref.set_value(obj, std::ref(nested)); // policy::prop::as_reference_wrapper\n"
+                                                        "</pre>");
+    nested_class nested;
+    nonius::benchmark benchmarks_group_4[] = { bench_native<property_class>([&nested](property_class& obj) { obj.nested_value = nested; return obj.nested_value.id; }),
+                                               bench_rttr_set_value<property_class>("nested_value", nested),
+                                               bench_rttr_set_value<property_class>("nested_value_ptr", &nested, "rttr - bind_as_ptr"),
+                                               bench_rttr_set_value<property_class>("nested_value_ref", std::ref(nested), "rttr - as_reference_wrapper") };
+
+    nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
+
+    /////////////////////////////////////
+
+    reporter.generate_report();
+    bench::add_results(reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,130 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_property/test_properties.h"
+
+#include <rttr/registration>
+
+RTTR_REGISTRATION
+{
+    using namespace rttr;
+
+    registration::class_<ns_foo::nested_class>("ns_foo::nested_class")
+        .property("id",     &ns_foo::nested_class::id)
+        .property("weight", &ns_foo::nested_class::weight)
+        .property("name",   &ns_foo::nested_class::name)
+        .property("values", &ns_foo::nested_class::values)
+        ;
+
+    registration::class_<ns_foo::property_class>("ns_foo::property_class")
+        .constructor<>()
+        .property("int_value",              &ns_foo::property_class::int_value)
+        .property("string_value",           &ns_foo::property_class::string_value)
+        .property("vector_value",           &ns_foo::property_class::vector_value)
+        .property("nested_value",           &ns_foo::property_class::nested_value)
+        .property("int_func",               &ns_foo::property_class::get_int_value,    &ns_foo::property_class::set_int_value)
+        .property("string_func",            &ns_foo::property_class::get_string_value, &ns_foo::property_class::set_string_value)
+        .property_readonly("int_readonly",  &ns_foo::property_class::int_value)
+        .property("vector_value_ptr",       &ns_foo::property_class::vector_value)
+        (
+            policy::prop::bind_as_ptr
+        )
+        .property("vector_value_ref",       &ns_foo::property_class::vector_value)
+        (
+            policy::prop::as_reference_wrapper
+        )
+        .property("nested_value_ptr",       &ns_foo::property_class::nested_value)
+        (
+            policy::prop::bind_as_ptr
+        )
+        .property("nested_value_ref",       &ns_foo::property_class::nested_value)
+        (
+            policy::prop::as_reference_wrapper
+        )
+        ;
+
+    registration::property("g_int_value",               &ns_foo::g_int_value)
+                 .property("g_string_value",            &ns_foo::g_string_value)
+                 .property_readonly("g_int_readonly",   &ns_foo::g_int_value);
+
+    PROPERTY_CLASS_REGISTER(property_class_base, 0)
+    PROPERTY_CLASS_REGISTER(property_class_d_1, 1)
+    PROPERTY_CLASS_REGISTER(property_class_d_2, 2)
+    PROPERTY_CLASS_REGISTER(property_class_d_3, 3)
+    PROPERTY_CLASS_REGISTER(property_class_d_4, 4)
+    PROPERTY_CLASS_REGISTER(property_class_d_5, 5)
+    PROPERTY_CLASS_REGISTER(property_class_d_6, 6)
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ns_foo
+{
+
+int         g_int_value     = 12345;
+std::string g_string_value  = "some text, which does not fit in the small buffer";
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+property_class::property_class()
+:   vector_value(100, 1)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int property_class::get_int_value() const
+{
+    return int_value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void property_class::set_int_value(int value)
+{
+    int_value = value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string& property_class::get_string_value() const
+{
+    return string_value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void property_class::set_string_value(const std::string& text)
+{
+    string_value = text;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace ns_foo
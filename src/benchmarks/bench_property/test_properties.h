@@ -0,0 +1,95 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TEST_PROPERTIES_H_
+#define RTTR_TEST_PROPERTIES_H_
+
+#include <rttr/type>
+
+#include <string>
+#include <vector>
+
+namespace ns_foo
+{
+
+struct nested_class
+{
+    int         id = 23;
+    double      weight = 42.0;
+    std::string name = "nested class";
+    std::vector<int> values = std::vector<int>(16, 1);
+};
+
+struct property_class
+{
+    property_class();
+
+    int get_int_value() const;
+    void set_int_value(int value);
+
+    const std::string& get_string_value() const;
+    void set_string_value(const std::string& text);
+
+    int                 int_value       = 12345;
+    std::string         string_value    = "some text, which does not fit in the small buffer";
+    std::vector<int>    vector_value;
+    nested_class        nested_value;
+
+    RTTR_ENABLE()
+};
+
+extern int          g_int_value;
+extern std::string  g_string_value;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#define PROPERTY_CLASS_INHERIT(CLASS1, CLASS2, NUMBER) struct CLASS1 : CLASS2 { int RTTR_CAT(value_,NUMBER) = NUMBER; RTTR_ENABLE(CLASS2) };
+
+struct property_class_base
+{
+    virtual ~property_class_base() {}
+    int value_0 = 0;
+
+    RTTR_ENABLE()
+};
+
+PROPERTY_CLASS_INHERIT(property_class_d_1, property_class_base, 1)
+PROPERTY_CLASS_INHERIT(property_class_d_2, property_class_d_1, 2)
+PROPERTY_CLASS_INHERIT(property_class_d_3, property_class_d_2, 3)
+PROPERTY_CLASS_INHERIT(property_class_d_4, property_class_d_3, 4)
+PROPERTY_CLASS_INHERIT(property_class_d_5, property_class_d_4, 5)
+PROPERTY_CLASS_INHERIT(property_class_d_6, property_class_d_5, 6)
+
+} // end namespace ns_foo
+
+#define PROPERTY_CLASS_REGISTER(CLASS_NAME, NUMBER) \
+    registration::class_<ns_foo::CLASS_NAME>("ns_foo::" #CLASS_NAME) \
+        .constructor<>() \
+        .property("value_" #NUMBER, &ns_foo::CLASS_NAME::RTTR_CAT(value_,NUMBER)) \
+        ;
+
+#endif // RTTR_TEST_PROPERTIES_H_
@@ -33,6 +33,8 @@
 #include <nonius/nonius.h++>
 #include <nonius/html_group_reporter.h>
 
+#include "benchmarks/common/bench_driver.h"
+
 #include <iostream>
 #include <memory>
 
@@ -918,6 +920,7 @@ void start_rttr_cast_benchmark()
     nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
 
     reporter.generate_report();
+    bench::add_results(reporter);
 }
 
 
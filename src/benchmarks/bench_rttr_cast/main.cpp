@@ -25,9 +25,11 @@
 *                                                                                   *
 *************************************************************************************/
 
+#include "benchmarks/common/bench_driver.h"
+
 extern void start_rttr_cast_benchmark();
 
 int main(int argc, char** argv)
 {
-    start_rttr_cast_benchmark();
+    return bench::run_benchmarks("bench_rttr_cast", argc, argv, start_rttr_cast_benchmark);
 }
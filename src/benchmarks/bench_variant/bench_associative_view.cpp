@@ -0,0 +1,165 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/variant.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include "benchmarks/common/bench_driver.h"
+
+#include <map>
+#include <string>
+
+struct big_struct
+{
+    double      m_values[32];
+    std::string m_name;
+};
+
+static const int g_element_count = 1000;
+
+// the result of every iteration is written to this variable, otherwise the loops might be optimized away
+static volatile double g_sink = 0.0;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::map<int, big_struct>& get_map()
+{
+    static std::map<int, big_struct> map;
+    if (map.empty())
+    {
+        for (int i = 0; i < g_element_count; ++i)
+        {
+            big_struct item;
+            for (auto& value : item.m_values)
+                value = static_cast<double>(i);
+            item.m_name = "item";
+            map.insert(std::make_pair(i, item));
+        }
+    }
+
+    return map;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_map_iteration()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        const auto& map = get_map();
+        meter.measure([&]()
+        {
+            double sum = 0.0;
+            for (const auto& item : map)
+                sum += item.first + item.second.m_values[0];
+            g_sink = sum;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_view_iteration_dereference()
+{
+    return nonius::benchmark("variant_associative_view - operator*()", [](nonius::chronometer meter)
+    {
+        auto& map = get_map();
+        rttr::variant var = std::ref(map);
+        auto view = var.create_associative_view();
+        meter.measure([&]()
+        {
+            double sum = 0.0;
+            for (const auto& item : view)
+                sum += item.first.get_wrapped_value<int>() + item.second.get_wrapped_value<big_struct>().m_values[0];
+            g_sink = sum;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_view_iteration_get_value()
+{
+    return nonius::benchmark("variant_associative_view - get_key()/get_value()", [](nonius::chronometer meter)
+    {
+        auto& map = get_map();
+        rttr::variant var = std::ref(map);
+        auto view = var.create_associative_view();
+        meter.measure([&]()
+        {
+            double sum = 0.0;
+            for (auto itr = view.begin(); itr != view.end(); ++itr)
+                sum += itr.get_key().get_wrapped_value<int>() + itr.get_value().get_wrapped_value<big_struct>().m_values[0];
+            g_sink = sum;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_view_iteration_get_value_ref()
+{
+    return nonius::benchmark("variant_associative_view - get_key_ref()/get_value_ref()", [](nonius::chronometer meter)
+    {
+        auto& map = get_map();
+        rttr::variant var = std::ref(map);
+        auto view = var.create_associative_view();
+        meter.measure([&]()
+        {
+            double sum = 0.0;
+            for (auto itr = view.begin(); itr != view.end(); ++itr)
+                sum += *itr.get_key_ref().try_convert<int>() + itr.get_value_ref().try_convert<big_struct>()->m_values[0];
+            g_sink = sum;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_associative_view()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::variant_associative_view iteration";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_associative_view.html");
+
+    reporter.set_current_group_name("iteration", "Iterating a <code>std::map&lt;int, big_struct&gt;</code> with 1000 elements.");
+    nonius::benchmark benchmarks_group_1[] = { bench_native_map_iteration(),
+                                               bench_view_iteration_dereference(),
+                                               bench_view_iteration_get_value(),
+                                               bench_view_iteration_get_value_ref()};
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    reporter.generate_report();
+    bench::add_results(reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
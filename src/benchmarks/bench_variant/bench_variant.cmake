@@ -28,5 +28,6 @@
 set(HEADER_FILES version.rc.in)
 
 set(SOURCE_FILES main.cpp
+                 bench_associative_view.cpp
                  bench_variant_conversion.cpp
                  bench_variant_create.cpp)
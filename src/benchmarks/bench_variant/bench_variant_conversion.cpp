@@ -31,6 +31,8 @@
 #include <nonius/nonius.h++>
 #include <nonius/html_group_reporter.h>
 
+#include "benchmarks/common/bench_driver.h"
+
 #include <locale>
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -58,6 +60,13 @@ static double setup_double()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+static uint64_t setup_uint64()
+{
+    return 18446744073709551000ULL;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 static bool setup_bool()
 {
     return true;
@@ -86,11 +95,32 @@ static std::string setup_string_double()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+static std::string setup_string_double_exponent()
+{
+    return std::string("-1.2345678901234567e-12");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string setup_string_uint64()
+{
+    return std::string("18446744073709551000");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 static std::string setup_string_bool()
 {
     return std::string("1");
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string setup_csv_line()
+{
+    return std::string("42,123456.123456,true");
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +314,102 @@ nonius::benchmark bench_variant_string_to_double()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_string_exponent_to_double()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        std::string number_string = setup_string_double_exponent();
+        double result;
+        meter.measure([&]()
+        {
+            std::size_t pos = 0;
+            result = std::stod(number_string, &pos);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_string_exponent_to_double()
+{
+    return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
+    {
+        rttr::variant var = setup_string_double_exponent();
+        double result = 0.0;
+        meter.measure([&]()
+        {
+            result = var.to_double();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_uint64_to_string()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        uint64_t var = setup_uint64();
+        std::string result;
+        meter.measure([&]()
+        {
+            result = std::to_string(var);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_uint64_to_string()
+{
+    return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
+    {
+        rttr::variant var = setup_uint64();
+        std::string result;
+        meter.measure([&]()
+        {
+            result = var.to_string();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_string_to_uint64()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        std::string number_string = setup_string_uint64();
+        uint64_t result = 0;
+        meter.measure([&]()
+        {
+            std::size_t pos = 0;
+            result = std::stoull(number_string, &pos);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_string_to_uint64()
+{
+    return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
+    {
+        rttr::variant var = setup_string_uint64();
+        uint64_t result = 0;
+        meter.measure([&]()
+        {
+            result = var.to_uint64();
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -357,6 +483,87 @@ nonius::benchmark bench_variant_string_to_bool()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_string_slice_to_double()
+{
+    return nonius::benchmark("rttr::variant", [](nonius::chronometer meter)
+    {
+        const std::string line = setup_csv_line();
+        const rttr::string_view slice(line.data() + 3, 13);
+        double result = 0.0;
+        meter.measure([&]()
+        {
+            rttr::variant var = slice.to_string();
+            result = var.to_double();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_convert_from_chars_to_double()
+{
+    return nonius::benchmark("rttr::variant::convert_from_chars", [](nonius::chronometer meter)
+    {
+        const std::string line = setup_csv_line();
+        const rttr::string_view slice(line.data() + 3, 13);
+        const rttr::type target_type = rttr::type::get<double>();
+        double result = 0.0;
+        meter.measure([&]()
+        {
+            result = rttr::variant::convert_from_chars(slice, target_type).get_value<double>();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+nonius::benchmark bench_variant_convert_to_type(const std::string& name, const rttr::variant& source)
+{
+    return nonius::benchmark(name, [source](nonius::chronometer meter)
+    {
+        const rttr::type target_type = rttr::type::get<T>();
+        rttr::variant var;
+        bool result = false;
+        meter.measure([&]()
+        {
+            var = source;
+            result = var.convert(target_type);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void bench_runtime_conversion_from(const nonius::configuration& cfg, nonius::html_group_reporter& reporter,
+                                          const std::string& source_name, const rttr::variant& source)
+{
+    reporter.set_current_group_name(source_name + " to arithmetic types", "Converts a variant with type <code>" + source_name +
+                                    "</code> to all arithmetic types:<br><pre>rttr::variant var = " + source_name +
+                                    "(42);\nvar.convert(type::get&lt;T&gt;());</pre>");
+
+    nonius::benchmark benchmarks[] = { bench_variant_convert_to_type<bool>("bool", source),
+                                       bench_variant_convert_to_type<char>("char", source),
+                                       bench_variant_convert_to_type<int8_t>("int8_t", source),
+                                       bench_variant_convert_to_type<int16_t>("int16_t", source),
+                                       bench_variant_convert_to_type<int32_t>("int32_t", source),
+                                       bench_variant_convert_to_type<int64_t>("int64_t", source),
+                                       bench_variant_convert_to_type<uint8_t>("uint8_t", source),
+                                       bench_variant_convert_to_type<uint16_t>("uint16_t", source),
+                                       bench_variant_convert_to_type<uint32_t>("uint32_t", source),
+                                       bench_variant_convert_to_type<uint64_t>("uint64_t", source),
+                                       bench_variant_convert_to_type<float>("float", source),
+                                       bench_variant_convert_to_type<double>("double", source)
+                                     };
+
+    nonius::go(cfg, std::begin(benchmarks), std::end(benchmarks), reporter);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -393,8 +600,8 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("float to string", "Converts a floating point number to a <code>std::string</code>:<br><pre>rttr::variant var = 123.12345f;\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_3[] = { bench_native_string_to_float(),
-                                               bench_variant_string_to_float()
+    nonius::benchmark benchmarks_group_3[] = { bench_native_float_to_string(),
+                                               bench_variant_float_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
@@ -403,8 +610,8 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("string to float", "Converts a <code>std::string</code> to a floating point number:<br><pre>rttr::variant var = std::string(\"123.12345\");\nvar.to_float().");
 
-    nonius::benchmark benchmarks_group_4[] = { bench_native_float_to_string(),
-                                               bench_variant_float_to_string()
+    nonius::benchmark benchmarks_group_4[] = { bench_native_string_to_float(),
+                                               bench_variant_string_to_float()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
@@ -413,8 +620,8 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("double to string", "Converts a double number to a <code>std::string</code>:<br><pre>rttr::variant var = 123456.123456;\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_5[] = { bench_native_string_to_double(),
-                                               bench_variant_string_to_double()
+    nonius::benchmark benchmarks_group_5[] = { bench_native_double_to_string(),
+                                               bench_variant_double_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
@@ -423,35 +630,91 @@ void bench_variant_conversion()
 
     reporter.set_current_group_name("string to double", "Converts a <code>std::string</code> to a double number:<br><pre>rttr::variant var = std::string(\"123456.123456\");\nvar.to_double();</pre>");
 
-    nonius::benchmark benchmarks_group_6[] = { bench_native_double_to_string(),
-                                               bench_variant_double_to_string()
+    nonius::benchmark benchmarks_group_6[] = { bench_native_string_to_double(),
+                                               bench_variant_string_to_double()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("bool to string", "Converts a bool number to a <code>std::string</code>:<br><pre>rttr::variant var = 123456.123456;\nvar.to_string();</pre>");
+    reporter.set_current_group_name("string to double (scientific)", "Converts a <code>std::string</code> in scientific notation to a double number:<br><pre>rttr::variant var = std::string(\"-1.2345678901234567e-12\");\nvar.to_double();</pre>");
 
-    nonius::benchmark benchmarks_group_7[] = { bench_native_string_to_bool(),
-                                               bench_variant_string_to_bool()
+    nonius::benchmark benchmarks_group_7[] = { bench_native_string_exponent_to_double(),
+                                               bench_variant_string_exponent_to_double()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
 
     //////////////////////////////////
 
-    reporter.set_current_group_name("string to bool", "Converts a <code>std::string</code> to a bool number:<br><pre>rttr::variant var = std::string(\"123456.123456\");\nvar.to_bool();</pre>");
+    reporter.set_current_group_name("uint64 to string", "Converts an unsigned 64 bit integer to a <code>std::string</code>:<br><pre>rttr::variant var = uint64_t(18446744073709551000);\nvar.to_string();</pre>");
 
-    nonius::benchmark benchmarks_group_8[] = { bench_native_bool_to_string(),
-                                               bench_variant_bool_to_string()
+    nonius::benchmark benchmarks_group_8[] = { bench_native_uint64_to_string(),
+                                               bench_variant_uint64_to_string()
                                               };
 
     nonius::go(cfg, std::begin(benchmarks_group_8), std::end(benchmarks_group_8), reporter);
 
     //////////////////////////////////
 
+    reporter.set_current_group_name("string to uint64", "Converts a <code>std::string</code> to an unsigned 64 bit integer:<br><pre>rttr::variant var = std::string(\"18446744073709551000\");\nvar.to_uint64();</pre>");
+
+    nonius::benchmark benchmarks_group_9[] = { bench_native_string_to_uint64(),
+                                               bench_variant_string_to_uint64()
+                                              };
+
+    nonius::go(cfg, std::begin(benchmarks_group_9), std::end(benchmarks_group_9), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("bool to string", "Converts a bool to a <code>std::string</code>:<br><pre>rttr::variant var = true;\nvar.to_string();</pre>");
+
+    nonius::benchmark benchmarks_group_10[] = { bench_native_bool_to_string(),
+                                               bench_variant_bool_to_string()
+                                              };
+
+    nonius::go(cfg, std::begin(benchmarks_group_10), std::end(benchmarks_group_10), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("string to bool", "Converts a <code>std::string</code> to a bool:<br><pre>rttr::variant var = std::string(\"1\");\nvar.to_bool();</pre>");
+
+    nonius::benchmark benchmarks_group_11[] = { bench_native_string_to_bool(),
+                                               bench_variant_string_to_bool()
+                                              };
+
+    nonius::go(cfg, std::begin(benchmarks_group_11), std::end(benchmarks_group_11), reporter);
+
+    //////////////////////////////////
+
+    reporter.set_current_group_name("string slice to double", "Parses a slice of a bigger buffer to a double number:<br><pre>rttr::string_view slice(\"42,123456.123456,true\" + 3, 13);\nrttr::variant::convert_from_chars(slice, type::get&lt;double&gt;());</pre>");
+
+    nonius::benchmark benchmarks_group_12[] = { bench_variant_string_slice_to_double(),
+                                                bench_variant_convert_from_chars_to_double()
+                                              };
+
+    nonius::go(cfg, std::begin(benchmarks_group_12), std::end(benchmarks_group_12), reporter);
+
+    //////////////////////////////////
+
+    bench_runtime_conversion_from(cfg, reporter, "bool", bool(42));
+    bench_runtime_conversion_from(cfg, reporter, "char", char(42));
+    bench_runtime_conversion_from(cfg, reporter, "int8_t", int8_t(42));
+    bench_runtime_conversion_from(cfg, reporter, "int16_t", int16_t(42));
+    bench_runtime_conversion_from(cfg, reporter, "int32_t", int32_t(42));
+    bench_runtime_conversion_from(cfg, reporter, "int64_t", int64_t(42));
+    bench_runtime_conversion_from(cfg, reporter, "uint8_t", uint8_t(42));
+    bench_runtime_conversion_from(cfg, reporter, "uint16_t", uint16_t(42));
+    bench_runtime_conversion_from(cfg, reporter, "uint32_t", uint32_t(42));
+    bench_runtime_conversion_from(cfg, reporter, "uint64_t", uint64_t(42));
+    bench_runtime_conversion_from(cfg, reporter, "float", 42.0f);
+    bench_runtime_conversion_from(cfg, reporter, "double", 42.0);
+
+    //////////////////////////////////
+
     reporter.generate_report();
+    bench::add_results(reporter);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
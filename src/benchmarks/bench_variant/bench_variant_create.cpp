@@ -32,6 +32,8 @@
 #include <nonius/nonius.h++>
 #include <nonius/html_group_reporter.h>
 
+#include "benchmarks/common/bench_driver.h"
+
 struct MyCustomType
 {
     int         m_data_i;
@@ -86,6 +88,21 @@ nonius::benchmark bench_variant_string_ctor()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_variant_interned_string_ctor()
+{
+    return nonius::benchmark("rttr::interned_string", [](nonius::chronometer meter)
+    {
+        const rttr::interned_string text("hello");
+        std::vector<nonius::storage_for<rttr::variant>> vec(meter.runs());
+        meter.measure([&](int i )
+        {
+           vec[i].construct(text);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_variant_char_ctor()
 {
     return nonius::benchmark("char", [](nonius::chronometer meter)
@@ -223,6 +240,24 @@ nonius::benchmark bench_variant_string_dtor()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_variant_interned_string_dtor()
+{
+    return nonius::benchmark("rttr::interned_string", [](nonius::chronometer meter)
+    {
+        const rttr::interned_string text("hello");
+        std::vector<nonius::destructable_object<rttr::variant>> vec(meter.runs());
+        for(auto&& item : vec)
+            item.construct(text);
+
+        meter.measure([&](int i )
+        {
+           vec[i].destruct();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 nonius::benchmark bench_variant_char_dtor()
 {
     return nonius::benchmark("char", [](nonius::chronometer meter)
@@ -327,6 +362,66 @@ nonius::benchmark bench_variant_custom_dtor()
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+nonius::benchmark bench_variant_assign_same_type()
+{
+    return nonius::benchmark("same type", [](nonius::chronometer meter)
+    {
+        const std::string text = "a text, which does not fit into the small string buffer";
+        rttr::variant var = text;
+        meter.measure([&]()
+        {
+            var = text;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_assign_variant_same_type()
+{
+    return nonius::benchmark("variant with same type", [](nonius::chronometer meter)
+    {
+        const rttr::variant other = std::string("a text, which does not fit into the small string buffer");
+        rttr::variant var = other;
+        meter.measure([&]()
+        {
+            var = other;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_assign_other_type()
+{
+    return nonius::benchmark("other type", [](nonius::chronometer meter)
+    {
+        const std::string text = "a text, which does not fit into the small string buffer";
+        rttr::variant var = 42;
+        meter.measure([&]()
+        {
+            var = 42;
+            var = text;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_variant_emplace()
+{
+    return nonius::benchmark("emplace", [](nonius::chronometer meter)
+    {
+        rttr::variant var;
+        meter.measure([&]()
+        {
+            var.emplace<std::string>("a text, which does not fit into the small string buffer");
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void bench_variant_create()
 {
     nonius::configuration cfg;
@@ -339,6 +434,7 @@ void bench_variant_create()
     nonius::benchmark benchmarks_group_1[] = { bench_variant_empty_ctor(),
                                                bench_variant_void_ctor(),
                                                bench_variant_string_ctor(),
+                                               bench_variant_interned_string_ctor(),
                                                bench_variant_char_ctor(),
                                                bench_variant_double_ctor(),
                                                bench_variant_float_ctor(),
@@ -351,6 +447,7 @@ void bench_variant_create()
     nonius::benchmark benchmarks_group_2[] = { bench_variant_empty_dtor(),
                                                bench_variant_void_dtor(),
                                                bench_variant_string_dtor(),
+                                               bench_variant_interned_string_dtor(),
                                                bench_variant_char_dtor(),
                                                bench_variant_double_dtor(),
                                                bench_variant_float_dtor(),
@@ -359,7 +456,15 @@ void bench_variant_create()
                                                bench_variant_bool_dtor()};
     nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
 
+    reporter.set_current_group_name("assignment", "The assignment of a <code>std::string</code> to a <code>rttr::variant</code>, which is reused.");
+    nonius::benchmark benchmarks_group_3[] = { bench_variant_assign_same_type(),
+                                               bench_variant_assign_variant_same_type(),
+                                               bench_variant_assign_other_type(),
+                                               bench_variant_emplace()};
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
     reporter.generate_report();
+    bench::add_results(reporter);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -25,15 +25,22 @@
 *                                                                                   *
 *************************************************************************************/
 
+#include "benchmarks/common/bench_driver.h"
+
 extern void bench_variant_create();
 extern void bench_variant_conversion();
+extern void bench_associative_view();
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 int main(int argc, char** argv)
 {
-    bench_variant_create();
-    bench_variant_conversion();
+    return bench::run_benchmarks("bench_variant", argc, argv, []()
+    {
+        bench_variant_create();
+        bench_variant_conversion();
+        bench_associative_view();
+    });
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,264 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BENCH_DRIVER_H_
+#define RTTR_BENCH_DRIVER_H_
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*!
+ * The common driver of all benchmark executables.
+ *
+ * Every benchmark executable accepts the following command line options:
+ *
+ *   --json <file>          writes the results of all benchmarks as JSON document into <file>
+ *   --baseline <file>      compares the results with a JSON document of a previous run
+ *   --threshold <percent>  a benchmark, whose mean is slower than the baseline by more than this value,
+ *                          is reported as regression (default: 10)
+ *
+ * The exit code is 0 on success, 1 when a regression was found and 2 for invalid arguments.
+ */
+namespace bench
+{
+
+struct bench_result
+{
+    std::string title;
+    std::string group;
+    std::string name;
+    double      mean;           // all durations in nanoseconds
+    double      lower_bound;
+    double      upper_bound;
+    double      std_dev;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+inline std::vector<bench_result>& get_results()
+{
+    static std::vector<bench_result> result_list;
+    return result_list;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Collects the results of all benchmarks, which were run with the given \p reporter.
+ */
+inline void add_results(const nonius::html_group_reporter& reporter)
+{
+    auto to_ns = [](nonius::fp_seconds value) { return value.count() * 1e9; };
+    reporter.visit_results([&](const std::string& title, const std::string& group, const std::string& name,
+                               const nonius::sample_analysis<nonius::fp_seconds>& analysis)
+    {
+        get_results().push_back({title, group, name, to_ns(analysis.mean.point), to_ns(analysis.mean.lower_bound),
+                                 to_ns(analysis.mean.upper_bound), to_ns(analysis.standard_deviation.point)});
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+inline std::string get_result_key(const std::string& title, const std::string& group, const std::string& name)
+{
+    return title + " / " + group + " / " + name;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+inline bool write_json_results(const std::string& file_name, const std::string& suite_name)
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+    writer.String("suite");
+    writer.String(suite_name.c_str());
+    writer.String("results");
+    writer.StartArray();
+    for (const auto& result : get_results())
+    {
+        writer.StartObject();
+        writer.String("title");             writer.String(result.title.c_str());
+        writer.String("group");             writer.String(result.group.c_str());
+        writer.String("name");              writer.String(result.name.c_str());
+        writer.String("mean_ns");           writer.Double(result.mean);
+        writer.String("lower_bound_ns");    writer.Double(result.lower_bound);
+        writer.String("upper_bound_ns");    writer.Double(result.upper_bound);
+        writer.String("std_dev_ns");        writer.Double(result.std_dev);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    std::ofstream file(file_name.c_str());
+    if (!file)
+        return false;
+
+    file << buffer.GetString() << "\n";
+    std::cout << "\nwritten JSON results: '" << file_name << "'\n";
+    return static_cast<bool>(file);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Compares the current results with the baseline file and returns the number of regressions,
+ * or -1 when the file could not be read.
+ */
+inline int compare_with_baseline(const std::string& file_name, double threshold)
+{
+    std::ifstream file(file_name.c_str());
+    if (!file)
+    {
+        std::cerr << "cannot open baseline file: '" << file_name << "'\n";
+        return -1;
+    }
+
+    std::stringstream content;
+    content << file.rdbuf();
+
+    rapidjson::Document document;
+    document.Parse(content.str().c_str());
+    if (document.HasParseError() || !document.IsObject() ||
+        !document.HasMember("results") || !document["results"].IsArray())
+    {
+        std::cerr << "invalid baseline file: '" << file_name << "'\n";
+        return -1;
+    }
+
+    std::vector<std::pair<std::string, double>> baseline_list;
+    for (const auto& item : document["results"].GetArray())
+    {
+        if (!item.IsObject() || !item.HasMember("title") || !item.HasMember("group") ||
+            !item.HasMember("name") || !item.HasMember("mean_ns"))
+            continue;
+
+        baseline_list.emplace_back(get_result_key(item["title"].GetString(), item["group"].GetString(), item["name"].GetString()),
+                                   item["mean_ns"].GetDouble());
+    }
+
+    std::cout << "\ncomparison with baseline '" << file_name << "' (threshold " << threshold << "%):\n";
+
+    int regression_count = 0;
+    for (const auto& result : get_results())
+    {
+        const auto key = get_result_key(result.title, result.group, result.name);
+        std::cout << "  " << key << ": ";
+
+        auto itr = std::find_if(baseline_list.begin(), baseline_list.end(),
+                                [&key](const std::pair<std::string, double>& item) { return (item.first == key); });
+        if (itr == baseline_list.end())
+        {
+            std::cout << std::fixed << std::setprecision(2) << result.mean << " ns (not in baseline)\n";
+            continue;
+        }
+
+        const double base_mean = itr->second;
+        const double change = (base_mean > 0.0) ? (result.mean - base_mean) / base_mean * 100.0 : 0.0;
+        std::cout << std::fixed << std::setprecision(2) << base_mean << " ns -> " << result.mean << " ns ("
+                  << std::showpos << change << std::noshowpos << "%)";
+        if (change > threshold)
+        {
+            std::cout << " REGRESSION";
+            ++regression_count;
+        }
+        std::cout << "\n";
+    }
+
+    std::cout << regression_count << " regression(s) found\n";
+    return regression_count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Parses the command line options, runs the benchmarks via \p func and handles the results.
+ *
+ * \return The exit code of the benchmark executable.
+ */
+template<typename F>
+inline int run_benchmarks(const std::string& suite_name, int argc, char** argv, F func)
+{
+    std::string json_file;
+    std::string baseline_file;
+    double threshold = 10.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (i + 1 < argc && arg == "--json")
+            json_file = argv[++i];
+        else if (i + 1 < argc && arg == "--baseline")
+            baseline_file = argv[++i];
+        else if (i + 1 < argc && arg == "--threshold")
+            threshold = std::atof(argv[++i]);
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [--json <file>] [--baseline <file>] [--threshold <percent>]\n";
+            return 2;
+        }
+    }
+
+    func();
+
+    if (!json_file.empty() && !write_json_results(json_file, suite_name))
+    {
+        std::cerr << "cannot write JSON results: '" << json_file << "'\n";
+        return 2;
+    }
+
+    if (!baseline_file.empty())
+    {
+        const int regression_count = compare_with_baseline(baseline_file, threshold);
+        if (regression_count < 0)
+            return 2;
+        if (regression_count > 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace bench
+
+#endif // RTTR_BENCH_DRIVER_H_
@@ -91,27 +91,28 @@ variant extract_basic_types(Value& json_value)
 static void write_array_recursively(variant_array_view& var_array, Value& json_array_value)
 {
     var_array.set_size(json_array_value.Size());
-    for (SizeType i = 0; i < json_array_value.Size(); ++i)
+    auto itr = var_array.begin();
+    for (SizeType i = 0; i < json_array_value.Size(); ++i, ++itr)
     {
         auto& json_index_value = json_array_value[i];
         if (json_index_value.IsArray())
         {
-            auto sub_array_view = var_array.get_value_as_ref(i).create_array_view();
+            auto sub_array_view = itr.get_value().create_array_view();
             write_array_recursively(sub_array_view, json_index_value);
         }
         else if (json_index_value.IsObject())
         {
-            variant var_tmp = var_array.get_value_as_ref(i);
+            variant var_tmp = itr.get_value();
             variant wrapped_var = var_tmp.extract_wrapped_value();
             fromjson_recursively(wrapped_var, json_index_value);
-            var_array.set_value(i, wrapped_var);
+            var_array.set_value(itr, wrapped_var);
         }
         else
         {
             const type array_type = var_array.get_rank_type(i);
             variant extracted_value = extract_basic_types(json_index_value);
             if (extracted_value.convert(array_type))
-                var_array.set_value(i, extracted_value);
+                var_array.set_value(itr, extracted_value);
         }
     }
 }
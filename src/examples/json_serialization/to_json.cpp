@@ -117,9 +117,9 @@ bool write_atomic_types_to_json(const type& t, const variant& var, PrettyWriter<
 static void write_array(const variant_array_view& a, PrettyWriter<StringBuffer>& writer)
 {
     writer.StartArray();
-    for (int i = 0; i < a.get_size(); ++i)
+    for (const auto& item : a)
     {
-        variant var = a.get_value_as_ref(i);
+        const variant& var = item;
         if (var.is_array())
         {
             write_array(var.create_array_view(), writer);
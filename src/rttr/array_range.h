@@ -290,6 +290,7 @@ public:
      *         Only elements which fulfill the condition of predicate will be included in the counter.
      *         That means, in order to determine the size of the range, the underlying algorithm needs to iterate
      *         through the whole range. So don't call it to often. It's better to cache the result in a temporary variable.
+     *         When the range was created without a predicate, the size is returned in constant time.
      *
      * \return The number of elements in the range.
      */
@@ -302,6 +303,7 @@ public:
      *         Only when every element doe not fulfill the condition of predicate, the range is declared empty.
      *         That means, in order to check for emptiness, the underlying algorithm needs to iterate
      *         through the whole range. So don't call it to often. It's better to cache the result in a temporary variable.
+     *         When the range was created without a predicate, the check is done in constant time.
      *
      * \return `True` if this range is empty, otherwise `false`.
      */
@@ -320,6 +322,7 @@ private:
     const T* const   m_begin;
     const T* const   m_end;
     const Predicate     m_pred;
+    const bool          m_has_predicate;
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
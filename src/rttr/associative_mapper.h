@@ -48,6 +48,8 @@ namespace rttr
  * - \p `std::unordered_map<Key, T>`
  * - \p `std::unordered_multiset<Key>`
  * - \p `std::unordered_multimap<Key, T>`
+ * - \p \ref sorted_vector_set "sorted_vector_set<Key>"
+ * - \p \ref sorted_vector_map "sorted_vector_map<Key, T>"
  *
  * Custom associative container
  * -----------------------------
@@ -86,6 +88,11 @@ namespace rttr
  *    13. `static void clear(void* container);`
  *    14. `static bool insert_key(void* container, argument& key, detail::iterator_data& itr);`
  *    15. `static bool insert_key_value(void* container, argument& key, argument& value, detail::iterator_data& itr);`
+ *    16. `static bool reserve(void* container, std::size_t size);`
+ *    17. `static std::size_t insert_range_key(void* container, const array_range<argument>& keys);`
+ *    18. `static std::size_t insert_range_key_value(void* container, const array_range<argument>& keys, const array_range<argument>& values);`
+ *    19. `static instance get_key_ref(const detail::iterator_data& itr);`
+ *    20. `static instance get_value_ref(const detail::iterator_data& itr);`
  *
  * The iterator itself is stored in the detail::iterator_data. You are free to use placement new (when the iterator has the same size as double)
  * or allocate on the iterator on the heap and store the pointer inside the detail::iterator_data.
@@ -133,6 +140,14 @@ struct associative_container_mapper
     {
     }
 
+    static instance get_key_ref(const detail::iterator_data& itr)
+    {
+    }
+
+    static instance get_value_ref(const detail::iterator_data& itr)
+    {
+    }
+
     static void find(void* container, detail::iterator_data& itr, argument& key)
     {
     }
@@ -157,6 +172,19 @@ struct associative_container_mapper
     static bool insert_key_value(void* container, argument& key, argument& value, detail::iterator_data& itr)
     {
     }
+
+    static bool reserve(void* container, std::size_t size)
+    {
+    }
+
+    static std::size_t insert_range_key(void* container, const array_range<argument>& keys)
+    {
+    }
+
+    static std::size_t insert_range_key_value(void* container, const array_range<argument>& keys,
+                                              const array_range<argument>& values)
+    {
+    }
 #endif
 };
 
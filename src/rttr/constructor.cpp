@@ -28,6 +28,7 @@
 #include "rttr/constructor.h"
 #include "rttr/detail/constructor/constructor_wrapper_base.h"
 #include "rttr/argument.h"
+#include "rttr/detail/misc/hot_path_counter.h"
 
 #include <utility>
 
@@ -121,8 +122,16 @@ variant constructor::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant constructor::get_metadata(const interned_string& key) const
+{
+    return m_wrapper->get_metadata(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant constructor::invoke() const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::constructor_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke();
 }
 
@@ -130,6 +139,7 @@ variant constructor::invoke() const
 
 variant constructor::invoke(argument arg1) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::constructor_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(arg1);
 }
 
@@ -137,6 +147,7 @@ variant constructor::invoke(argument arg1) const
 
 variant constructor::invoke(argument arg1, argument arg2) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::constructor_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(arg1, arg2);
 }
 
@@ -144,6 +155,7 @@ variant constructor::invoke(argument arg1, argument arg2) const
 
 variant constructor::invoke(argument arg1, argument arg2, argument arg3) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::constructor_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(arg1, arg2, arg3);
 }
 
@@ -151,6 +163,7 @@ variant constructor::invoke(argument arg1, argument arg2, argument arg3) const
 
 variant constructor::invoke(argument arg1, argument arg2, argument arg3, argument arg4) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::constructor_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(arg1, arg2, arg3, arg4);
 }
 
@@ -159,6 +172,7 @@ variant constructor::invoke(argument arg1, argument arg2, argument arg3, argumen
 variant constructor::invoke(argument arg1, argument arg2, argument arg3, argument arg4,
                             argument arg5) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::constructor_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(arg1, arg2, arg3, arg4, arg5);
 }
 
@@ -167,6 +181,7 @@ variant constructor::invoke(argument arg1, argument arg2, argument arg3, argumen
 variant constructor::invoke(argument arg1, argument arg2, argument arg3, argument arg4,
                             argument arg5, argument arg6) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::constructor_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(arg1, arg2, arg3, arg4, arg5, arg6);
 }
 
@@ -174,6 +189,7 @@ variant constructor::invoke(argument arg1, argument arg2, argument arg3, argumen
 
 variant constructor::invoke_variadic(std::vector<argument> args) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::constructor_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke_variadic(args);
 }
 
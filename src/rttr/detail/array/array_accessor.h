@@ -29,6 +29,7 @@
 #define RTTR_ARRAY_ACCESSOR_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/array/array_index_list.h"
 
 namespace rttr
 {
@@ -45,25 +46,25 @@ struct array_accessor
     template<typename... Indices>
     static std::size_t get_size(const Array_Type& array, Indices... args);
 
-    static std::size_t get_size(const Array_Type& array, const std::vector<std::size_t>& index_list);
+    static std::size_t get_size(const Array_Type& array, const index_list_view& index_list);
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
     template<typename... Indices>
     static bool set_size(const Array_Type&, std::size_t, Indices... indices);
-    static bool set_size(const Array_Type&, std::size_t, const std::vector<std::size_t>&);
+    static bool set_size(const Array_Type&, std::size_t, const index_list_view&);
 
     template<typename... Indices>
     static bool set_size(Array_Type& array, std::size_t new_size, Indices... args);
 
-    static bool set_size(Array_Type& array, std::size_t new_size, const std::vector<std::size_t>& index_list);
+    static bool set_size(Array_Type& array, std::size_t new_size, const index_list_view& index_list);
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
     template<typename... Indices>
     static variant get_value(const Array_Type& array, Indices... indices);
 
-    static variant get_value(const Array_Type& array, const std::vector<std::size_t>& index_list);
+    static variant get_value(const Array_Type& array, const index_list_view& index_list);
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -74,32 +75,32 @@ struct array_accessor
 
     template<typename... Indices>
     static bool set_value(const Array_Type&, argument&, Indices... indices);
-    static bool set_value(const Array_Type&, argument&, const std::vector<std::size_t>&);
+    static bool set_value(const Array_Type&, argument&, const index_list_view&);
 
     template<typename... Indices>
     static bool set_value(Array_Type& array, argument& arg, Indices... indices);
 
-    static bool set_value(Array_Type& array, argument& arg, const std::vector<std::size_t>& index_list);
+    static bool set_value(Array_Type& array, argument& arg, const index_list_view& index_list);
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
     template<typename... Indices>
     static bool insert_value(const Array_Type&, argument&, Indices... indices);
-    static bool insert_value(const Array_Type&, argument&, const std::vector<std::size_t>&);
+    static bool insert_value(const Array_Type&, argument&, const index_list_view&);
 
     template<typename... Indices>
     static bool insert_value(Array_Type& array, argument& arg, Indices... indices);
-    static bool insert_value(Array_Type& array, argument& arg, const std::vector<std::size_t>& index_list);
+    static bool insert_value(Array_Type& array, argument& arg, const index_list_view& index_list);
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
     template<typename... Indices>
     static bool remove_value(const Array_Type&, Indices... indices);
-    static bool remove_value(const Array_Type&, const std::vector<std::size_t>&);
+    static bool remove_value(const Array_Type&, const index_list_view&);
 
     template<typename... Indices>
     static bool remove_value(Array_Type& array, Indices... indices);
-    static bool remove_value(Array_Type& array, const std::vector<std::size_t>& index_list);
+    static bool remove_value(Array_Type& array, const index_list_view& index_list);
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
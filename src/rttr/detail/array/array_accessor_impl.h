@@ -464,7 +464,7 @@ struct array_accessor_variadic<Array_Type, index_sequence<N...>>
 {
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static std::size_t get_size(const Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static std::size_t get_size(const Array_Type& obj, const index_list_view& index_list)
     {
         using is_rank_in_range = typename std::integral_constant< bool, (sizeof...(N) < rank<Array_Type>::value) >::type;
         return array_accessor_impl<Array_Type, is_rank_in_range>::get_size(obj, index_list[N]...);
@@ -472,7 +472,7 @@ struct array_accessor_variadic<Array_Type, index_sequence<N...>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool set_size(Array_Type& obj, std::size_t new_size, const std::vector<std::size_t>& index_list)
+    static bool set_size(Array_Type& obj, std::size_t new_size, const index_list_view& index_list)
     {
         using is_rank_in_range = typename std::integral_constant< bool, (sizeof...(N) < rank<Array_Type>::value) >::type;
         return array_accessor_impl<Array_Type, is_rank_in_range>::set_size(obj, new_size, index_list[N]...);
@@ -480,7 +480,7 @@ struct array_accessor_variadic<Array_Type, index_sequence<N...>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static variant get_value(const Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static variant get_value(const Array_Type& obj, const index_list_view& index_list)
     {
         using is_rank_in_range = typename std::integral_constant<bool, (sizeof...(N) <= rank<Array_Type>::value) >::type;
         return array_accessor_impl<Array_Type, is_rank_in_range>::get_value(obj, index_list[N]...);
@@ -488,7 +488,7 @@ struct array_accessor_variadic<Array_Type, index_sequence<N...>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool set_value(Array_Type& obj, argument& arg, const std::vector<std::size_t>& index_list)
+    static bool set_value(Array_Type& obj, argument& arg, const index_list_view& index_list)
     {
         using is_rank_in_range = typename std::integral_constant<bool, (sizeof...(N) <= rank<Array_Type>::value) >::type;
         return array_accessor_impl<Array_Type, is_rank_in_range>::set_value(obj, arg, index_list[N]...);
@@ -496,7 +496,7 @@ struct array_accessor_variadic<Array_Type, index_sequence<N...>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool insert_value(Array_Type& obj, argument& arg, const std::vector<std::size_t>& index_list)
+    static bool insert_value(Array_Type& obj, argument& arg, const index_list_view& index_list)
     {
         using is_rank_in_range = typename std::integral_constant<bool, (sizeof...(N) <= rank<Array_Type>::value) >::type;
         return array_accessor_impl<Array_Type, is_rank_in_range>::insert_value(obj, arg, index_list[N]...);
@@ -504,7 +504,7 @@ struct array_accessor_variadic<Array_Type, index_sequence<N...>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool remove_value(Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static bool remove_value(Array_Type& obj, const index_list_view& index_list)
     {
         using is_rank_in_range = typename std::integral_constant<bool, (sizeof...(N) <= rank<Array_Type>::value) >::type;
         return array_accessor_impl<Array_Type, is_rank_in_range>::remove_value(obj, index_list[N]...);
@@ -518,7 +518,7 @@ struct array_accessor_impl<Array_Type, std::integral_constant<std::size_t, N>>
 {
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static std::size_t get_size(const Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static std::size_t get_size(const Array_Type& obj, const index_list_view& index_list)
     {
         if (index_list.size() == N)
             return array_accessor_variadic<Array_Type, make_index_sequence<N>>::get_size(obj, index_list);
@@ -528,7 +528,7 @@ struct array_accessor_impl<Array_Type, std::integral_constant<std::size_t, N>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool set_size(Array_Type& obj, std::size_t new_size, const std::vector<std::size_t>& index_list)
+    static bool set_size(Array_Type& obj, std::size_t new_size, const index_list_view& index_list)
     {
         if (index_list.size() == N)
             return array_accessor_variadic<Array_Type, make_index_sequence<N>>::set_size(obj, new_size, index_list);
@@ -538,7 +538,7 @@ struct array_accessor_impl<Array_Type, std::integral_constant<std::size_t, N>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static variant get_value(const Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static variant get_value(const Array_Type& obj, const index_list_view& index_list)
     {
         if (index_list.size() == N)
             return array_accessor_variadic<Array_Type, make_index_sequence<N>>::get_value(obj, index_list);
@@ -548,7 +548,7 @@ struct array_accessor_impl<Array_Type, std::integral_constant<std::size_t, N>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool set_value(Array_Type& obj, argument& arg, const std::vector<std::size_t>& index_list)
+    static bool set_value(Array_Type& obj, argument& arg, const index_list_view& index_list)
     {
         if (index_list.size() == N)
             return array_accessor_variadic<Array_Type, make_index_sequence<N>>::set_value(obj, arg, index_list);
@@ -558,7 +558,7 @@ struct array_accessor_impl<Array_Type, std::integral_constant<std::size_t, N>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool insert_value(Array_Type& obj, argument& arg, const std::vector<std::size_t>& index_list)
+    static bool insert_value(Array_Type& obj, argument& arg, const index_list_view& index_list)
     {
         if (index_list.size() == N)
             return array_accessor_variadic<Array_Type, make_index_sequence<N>>::insert_value(obj, arg, index_list);
@@ -568,7 +568,7 @@ struct array_accessor_impl<Array_Type, std::integral_constant<std::size_t, N>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool remove_value(Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static bool remove_value(Array_Type& obj, const index_list_view& index_list)
     {
         if (index_list.size() == N)
             return array_accessor_variadic<Array_Type, make_index_sequence<N>>::remove_value(obj, index_list);
@@ -592,28 +592,28 @@ struct array_accessor_impl<Array_Type, std::integral_constant<std::size_t, 0>>
 {
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static std::size_t get_size(const Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static std::size_t get_size(const Array_Type& obj, const index_list_view& index_list)
     {
         return array_accessor_impl<Array_Type, std::true_type>::get_size(obj);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool set_size(Array_Type& obj, std::size_t new_size, const std::vector<std::size_t>& index_list)
+    static bool set_size(Array_Type& obj, std::size_t new_size, const index_list_view& index_list)
     {
         return array_accessor_impl<Array_Type, std::true_type>::set_size(obj, new_size);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static variant get_value(const Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static variant get_value(const Array_Type& obj, const index_list_view& index_list)
     {
         return variant(); // one index at least needed, otherwise the whole array would be returned
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool set_value(Array_Type& obj, argument& arg, const std::vector<std::size_t>& index_list)
+    static bool set_value(Array_Type& obj, argument& arg, const index_list_view& index_list)
     {
         // copy the whole array
         return array_accessor_impl<Array_Type, std::true_type>::set_value(obj, arg);
@@ -621,14 +621,14 @@ struct array_accessor_impl<Array_Type, std::integral_constant<std::size_t, 0>>
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool insert_value(Array_Type& obj, argument& arg, const std::vector<std::size_t>& index_list)
+    static bool insert_value(Array_Type& obj, argument& arg, const index_list_view& index_list)
     {
         return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////
 
-    static bool remove_value(Array_Type& obj, const std::vector<std::size_t>& index_list)
+    static bool remove_value(Array_Type& obj, const index_list_view& index_list)
     {
         return false;
     }
@@ -658,7 +658,7 @@ std::size_t array_accessor<Array_Type>::get_size(const Array_Type& array, Indice
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-std::size_t array_accessor<Array_Type>::get_size(const Array_Type& array, const std::vector<std::size_t>& index_list)
+std::size_t array_accessor<Array_Type>::get_size(const Array_Type& array, const index_list_view& index_list)
 {
     if (index_list.size() < rank<Array_Type>::value)
         return array_accessor_impl<Array_Type, std::integral_constant<std::size_t, rank<Array_Type>::value - 1>>::get_size(array, index_list);
@@ -676,7 +676,7 @@ bool array_accessor<Array_Type>::set_size(const Array_Type&, std::size_t, Indice
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-bool array_accessor<Array_Type>::set_size(const Array_Type&, std::size_t, const std::vector<std::size_t>&) { return false; }
+bool array_accessor<Array_Type>::set_size(const Array_Type&, std::size_t, const index_list_view&) { return false; }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -691,7 +691,7 @@ bool array_accessor<Array_Type>::set_size(Array_Type& array, std::size_t new_siz
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-bool array_accessor<Array_Type>::set_size(Array_Type& array, std::size_t new_size, const std::vector<std::size_t>& index_list)
+bool array_accessor<Array_Type>::set_size(Array_Type& array, std::size_t new_size, const index_list_view& index_list)
 {
     if (index_list.size() < rank<Array_Type>::value)
         return array_accessor_impl<Array_Type, std::integral_constant<std::size_t, rank<Array_Type>::value - 1>>::set_size(array, new_size, index_list);
@@ -713,7 +713,7 @@ variant array_accessor<Array_Type>::get_value(const Array_Type& array, Indices..
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-variant array_accessor<Array_Type>::get_value(const Array_Type& array, const std::vector<std::size_t>& index_list)
+variant array_accessor<Array_Type>::get_value(const Array_Type& array, const index_list_view& index_list)
 {
     if (index_list.size() <= rank<Array_Type>::value)
         return array_accessor_impl<Array_Type, std::integral_constant<std::size_t, rank<Array_Type>::value>>::get_value(array, index_list);
@@ -774,7 +774,7 @@ bool array_accessor<Array_Type>::set_value(const Array_Type&, argument&, Indices
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-bool array_accessor<Array_Type>::set_value(const Array_Type&, argument&, const std::vector<std::size_t>&) { return false; }
+bool array_accessor<Array_Type>::set_value(const Array_Type&, argument&, const index_list_view&) { return false; }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -789,7 +789,7 @@ bool array_accessor<Array_Type>::set_value(Array_Type& array, argument& arg, Ind
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-bool array_accessor<Array_Type>::set_value(Array_Type& array, argument& arg, const std::vector<std::size_t>& index_list)
+bool array_accessor<Array_Type>::set_value(Array_Type& array, argument& arg, const index_list_view& index_list)
 {
     if (index_list.size() <= rank<Array_Type>::value)
         return array_accessor_impl<Array_Type, std::integral_constant<std::size_t, rank<Array_Type>::value>>::set_value(array, arg, index_list);
@@ -807,7 +807,7 @@ bool array_accessor<Array_Type>::insert_value(const Array_Type&, argument&, Indi
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-bool array_accessor<Array_Type>::insert_value(const Array_Type&, argument&, const std::vector<std::size_t>&) { return false; }
+bool array_accessor<Array_Type>::insert_value(const Array_Type&, argument&, const index_list_view&) { return false; }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -822,7 +822,7 @@ bool array_accessor<Array_Type>::insert_value(Array_Type& array, argument& arg,
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-bool array_accessor<Array_Type>::insert_value(Array_Type& array, argument& arg, const std::vector<std::size_t>& index_list)
+bool array_accessor<Array_Type>::insert_value(Array_Type& array, argument& arg, const index_list_view& index_list)
 {
     if (index_list.size() <= rank<Array_Type>::value)
         return array_accessor_impl<Array_Type, std::integral_constant<std::size_t, rank<Array_Type>::value>>::insert_value(array, arg, index_list);
@@ -840,7 +840,7 @@ bool array_accessor<Array_Type>::remove_value(const Array_Type&, Indices... indi
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-bool array_accessor<Array_Type>::remove_value(const Array_Type&, const std::vector<std::size_t>&) { return false; }
+bool array_accessor<Array_Type>::remove_value(const Array_Type&, const index_list_view&) { return false; }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -855,7 +855,7 @@ bool array_accessor<Array_Type>::remove_value(Array_Type& array, Indices... indi
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Array_Type>
-bool array_accessor<Array_Type>::remove_value(Array_Type& array, const std::vector<std::size_t>& index_list)
+bool array_accessor<Array_Type>::remove_value(Array_Type& array, const index_list_view& index_list)
 {
     if (index_list.size() <= rank<Array_Type>::value)
         return array_accessor_impl<Array_Type, std::integral_constant<std::size_t, rank<Array_Type>::value>>::remove_value(array, index_list);
@@ -0,0 +1,79 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ARRAY_INDEX_LIST_H_
+#define RTTR_ARRAY_INDEX_LIST_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <vector>
+#include <array>
+#include <cstddef>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * A non-owning view of a list of array indices.
+ *
+ * It can be created from a `std::vector<std::size_t>` as well as from a `std::array<std::size_t, N>`,
+ * so fixed-arity index lists do not need any heap allocation.
+ */
+class index_list_view
+{
+    public:
+        RTTR_INLINE index_list_view(const std::vector<std::size_t>& index_list) RTTR_NOEXCEPT
+        :   m_data(index_list.data()), m_size(index_list.size())
+        {
+        }
+
+        template<std::size_t N>
+        RTTR_INLINE index_list_view(const std::array<std::size_t, N>& index_list) RTTR_NOEXCEPT
+        :   m_data(index_list.data()), m_size(N)
+        {
+        }
+
+        RTTR_INLINE index_list_view(const std::size_t* data, std::size_t size) RTTR_NOEXCEPT
+        :   m_data(data), m_size(size)
+        {
+        }
+
+        RTTR_INLINE std::size_t size() const RTTR_NOEXCEPT { return m_size; }
+        RTTR_INLINE std::size_t operator[](std::size_t index) const RTTR_NOEXCEPT { return m_data[index]; }
+
+    private:
+        const std::size_t*  m_data;
+        std::size_t         m_size;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ARRAY_INDEX_LIST_H_
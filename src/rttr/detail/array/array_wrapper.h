@@ -32,12 +32,15 @@
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/detail/array/array_wrapper_base.h"
 #include "rttr/detail/array/array_accessor.h"
+#include "rttr/detail/misc/iterator_wrapper.h"
 #include "rttr/detail/misc/utility.h"
 #include "rttr/array_mapper.h"
 #include "rttr/wrapper_mapper.h"
 
 #include <type_traits>
 #include <cstddef>
+#include <iterator>
+#include <algorithm>
 
 namespace rttr
 {
@@ -46,6 +49,382 @@ class argument;
 namespace detail
 {
 
+/*!
+ * Determines whether the elements of the array type \p T are stored in one contiguous block of memory.
+ */
+template<typename T>
+struct is_contiguous_array : std::false_type {};
+
+template<typename T, std::size_t N>
+struct is_contiguous_array<T[N]> : std::true_type {};
+
+template<typename T, std::size_t N>
+struct is_contiguous_array<std::array<T, N>> : std::true_type {};
+
+template<typename T>
+struct is_contiguous_array<std::vector<T>> : std::true_type {};
+
+template<>
+struct is_contiguous_array<std::vector<bool>> : std::false_type {};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Describes an array type \p T, which consists only of nested raw arrays and `std::array`'s,
+ * like `float[4][4]` or `std::array<std::array<int, 3>, 3>`.
+ * All innermost elements of such an array are stored in one block of memory,
+ * so they can be accessed with one linear index.
+ */
+template<typename T>
+struct flat_array_traits
+{
+    using element_type = T;
+    static RTTR_CONSTEXPR_OR_CONST std::size_t count = 1;
+};
+
+template<typename T, std::size_t N>
+struct flat_array_traits<T[N]>
+{
+    using element_type = typename flat_array_traits<T>::element_type;
+    static RTTR_CONSTEXPR_OR_CONST std::size_t count = N * flat_array_traits<T>::count;
+};
+
+template<typename T, std::size_t N>
+struct flat_array_traits<std::array<T, N>>
+{
+    using element_type = typename flat_array_traits<T>::element_type;
+    static RTTR_CONSTEXPR_OR_CONST std::size_t count = N * flat_array_traits<T>::count;
+};
+
+template<typename T>
+using is_flat_array = std::integral_constant<bool, (std::is_array<T>::value || is_contiguous_array<T>::value) &&
+                                                   !is_contiguous_array<typename flat_array_traits<T>::element_type>::value &&
+                                                   sizeof(T) == sizeof(typename flat_array_traits<T>::element_type) * flat_array_traits<T>::count>;
+
+/*!
+ * Accesses the innermost elements of the array type \p Array with a linear index.
+ */
+template<typename Array, bool = is_flat_array<raw_type_t<Array>>::value>
+struct array_flat_access
+{
+    using traits = flat_array_traits<raw_type_t<Array>>;
+    using element_type = typename traits::element_type;
+
+    static std::size_t get_size(Array& array)
+    {
+        return traits::count;
+    }
+
+    static variant get_value(Array& array, std::size_t index)
+    {
+        if (index < traits::count)
+            return variant(get_elements(array)[index]);
+        else
+            return variant();
+    }
+
+    static bool set_value(Array& array, std::size_t index, argument& arg)
+    {
+        return set_value_impl(array, index, arg, std::is_const<Array>());
+    }
+
+    private:
+        using element_ptr = conditional_t<std::is_const<Array>::value, const element_type*, element_type*>;
+
+        static element_ptr get_elements(Array& array)
+        {
+            return reinterpret_cast<element_ptr>(&array);
+        }
+
+        static bool set_value_impl(Array& array, std::size_t index, argument& arg, std::false_type)
+        {
+            if (index >= traits::count || !arg.is_type<element_type>())
+                return false;
+
+            get_elements(array)[index] = arg.get_value<element_type>();
+            return true;
+        }
+
+        static bool set_value_impl(Array& array, std::size_t index, argument& arg, std::true_type)
+        {
+            return false;
+        }
+};
+
+template<typename Array>
+struct array_flat_access<Array, false>
+{
+    static std::size_t get_size(Array&)                             { return 0; }
+    static variant get_value(Array&, std::size_t)                   { return variant(); }
+    static bool set_value(Array&, std::size_t, argument&)           { return false; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, std::size_t N>
+RTTR_INLINE const void* get_contiguous_address(const T (&arr)[N]) { return arr; }
+
+template<typename T>
+RTTR_INLINE const void* get_contiguous_address(const T& arr) { return arr.data(); }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Iterates over the first dimension of the array type \p Array (which might be const qualified).
+ *
+ * When the array provides `std::begin()` and `std::end()`, its native iterator is stored inside the
+ * `iterator_data`, so traversing e.g. a `std::list<T>` is linear.
+ * Otherwise the element index is stored and every access goes through the \ref array_mapper.
+ */
+template<typename Array, bool = has_begin_end<Array>::value>
+struct array_iterator_access
+{
+    using itr_t = decltype(std::begin(std::declval<Array&>()));
+    using itr_wrapper = iterator_wrapper_base<itr_t>;
+    using element_t = decltype(*std::declval<itr_t>());
+
+    static void begin(Array& array, iterator_data& itr)
+    {
+        itr_wrapper::create(itr, std::begin(array));
+    }
+
+    static void end(Array& array, iterator_data& itr)
+    {
+        itr_wrapper::create(itr, std::end(array));
+    }
+
+    static void advance(Array& array, iterator_data& itr)
+    {
+        ++itr_wrapper::get_iterator(itr);
+    }
+
+    static variant get_value(Array& array, const iterator_data& itr)
+    {
+        return get_value_impl(*itr_wrapper::get_iterator(itr), std::is_reference<element_t>());
+    }
+
+    static bool set_value(Array& array, const iterator_data& itr, argument& arg)
+    {
+        return set_value_impl(itr_wrapper::get_iterator(itr), arg, std::is_const<Array>());
+    }
+
+    private:
+        template<typename E>
+        static variant get_value_impl(E& value, std::true_type)
+        {
+            return variant(std::ref(value));
+        }
+
+        template<typename E>
+        static variant get_value_impl(const E& value, std::false_type)
+        {
+            // proxy objects, like 'std::vector<bool>::reference', are returned by value
+            using sub_type = typename array_mapper<raw_type_t<Array>>::sub_type;
+            return variant(static_cast<sub_type>(value));
+        }
+
+        static bool set_value_impl(const itr_t& itr, argument& arg, std::false_type)
+        {
+            using sub_type = typename array_mapper<raw_type_t<Array>>::sub_type;
+            if (!arg.is_type<sub_type>())
+                return false;
+
+            set_value_to_array_impl<remove_reference_t<element_t>, std::false_type>::set_value(*itr, arg.get_value<sub_type>());
+            return true;
+        }
+
+        static bool set_value_impl(const itr_t& itr, argument& arg, std::true_type)
+        {
+            return false;
+        }
+};
+
+template<typename Array>
+struct array_iterator_access<Array, false>
+{
+    using itr_wrapper = iterator_wrapper_base<std::size_t>;
+    using Array_Type = raw_type_t<Array>;
+
+    static void begin(Array& array, iterator_data& itr)
+    {
+        itr_wrapper::create(itr, std::size_t(0));
+    }
+
+    static void end(Array& array, iterator_data& itr)
+    {
+        itr_wrapper::create(itr, array_mapper<Array_Type>::get_size(array));
+    }
+
+    static void advance(Array& array, iterator_data& itr)
+    {
+        ++itr_wrapper::get_iterator(itr);
+    }
+
+    static variant get_value(Array& array, const iterator_data& itr)
+    {
+        return array_accessor<Array_Type>::get_value_as_ref(array, itr_wrapper::get_iterator(itr));
+    }
+
+    static bool set_value(Array& array, const iterator_data& itr, argument& arg)
+    {
+        return array_accessor<Array_Type>::set_value(array, arg, itr_wrapper::get_iterator(itr));
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Implements the bulk operations of the \ref variant_array_view for the first dimension of the array type \p Array.
+ *
+ * The size of the array is changed only once, the types of all arguments are checked before the array is modified
+ * and the elements are written via the native iterator, when one is available.
+ */
+template<typename Array, bool = std::is_const<Array>::value>
+struct array_bulk_access
+{
+    using Array_Type = raw_type_t<Array>;
+    using sub_type = typename array_mapper<Array_Type>::sub_type;
+
+    static bool reserve(Array& array, std::size_t new_capacity)
+    {
+        return reserve_impl(array, new_capacity, has_reserve_func<Array>());
+    }
+
+    template<typename Argument_Range>
+    static bool assign(Array& array, const Argument_Range& values)
+    {
+        const std::size_t count = values.size();
+        if (!is_type_valid(values) || !prepare_size(array, count))
+            return false;
+
+        write_arguments(array, values, 0, has_begin_end<Array>());
+        return true;
+    }
+
+    template<typename Argument_Range>
+    static bool append_range(Array& array, const Argument_Range& values)
+    {
+        if (!array_mapper<Array_Type>::is_dynamic() || !is_type_valid(values))
+            return false;
+
+        const std::size_t old_size = array_mapper<Array_Type>::get_size(array);
+        if (!array_mapper<Array_Type>::set_size(array, old_size + values.size()))
+            return false;
+
+        write_arguments(array, values, old_size, has_begin_end<Array>());
+        return true;
+    }
+
+    static bool assign_from(Array& array, const void* data, std::size_t count, const type& element_type)
+    {
+        if (element_type != type::get<sub_type>())
+            return false;
+
+        return assign_from_impl(array, static_cast<const sub_type*>(data), count, std::is_copy_assignable<sub_type>());
+    }
+
+    private:
+        template<typename Argument_Range>
+        static bool is_type_valid(const Argument_Range& values)
+        {
+            for (const auto& arg : values)
+            {
+                if (!arg.template is_type<sub_type>())
+                    return false;
+            }
+            return true;
+        }
+
+        static bool prepare_size(Array& array, std::size_t count)
+        {
+            if (array_mapper<Array_Type>::is_dynamic())
+                return array_mapper<Array_Type>::set_size(array, count);
+            else
+                return (array_mapper<Array_Type>::get_size(array) == count);
+        }
+
+        static bool reserve_impl(Array& array, std::size_t new_capacity, std::true_type)
+        {
+            array.reserve(new_capacity);
+            return true;
+        }
+
+        static bool reserve_impl(Array& array, std::size_t new_capacity, std::false_type)
+        {
+            return false;
+        }
+
+        template<typename Argument_Range>
+        static void write_arguments(Array& array, const Argument_Range& values, std::size_t offset, std::true_type)
+        {
+            auto itr = std::begin(array);
+            std::advance(itr, offset);
+            for (const auto& arg : values)
+            {
+                set_value_to_array_impl<remove_reference_t<decltype(*itr)>, std::false_type>::set_value(*itr, arg.template get_value<sub_type>());
+                ++itr;
+            }
+        }
+
+        template<typename Argument_Range>
+        static void write_arguments(Array& array, const Argument_Range& values, std::size_t index, std::false_type)
+        {
+            for (const auto& arg : values)
+                set_value_to_array(array, arg.template get_value<sub_type>(), index++);
+        }
+
+        static bool assign_from_impl(Array& array, const sub_type* data, std::size_t count, std::true_type)
+        {
+            return assign_elements(array, data, count, std::is_same<Array, std::vector<sub_type>>());
+        }
+
+        static bool assign_from_impl(Array& array, const sub_type* data, std::size_t count, std::false_type)
+        {
+            return false;
+        }
+
+        static bool assign_elements(Array& array, const sub_type* data, std::size_t count, std::true_type)
+        {
+            // a vector can copy the whole block at once, without initializing the new elements first
+            array.assign(data, data + count);
+            return true;
+        }
+
+        static bool assign_elements(Array& array, const sub_type* data, std::size_t count, std::false_type)
+        {
+            if (!prepare_size(array, count))
+                return false;
+
+            copy_elements(array, data, count, has_begin_end<Array>());
+            return true;
+        }
+
+        static void copy_elements(Array& array, const sub_type* data, std::size_t count, std::true_type)
+        {
+            std::copy(data, data + count, std::begin(array));
+        }
+
+        static void copy_elements(Array& array, const sub_type* data, std::size_t count, std::false_type)
+        {
+            for (std::size_t index = 0; index < count; ++index)
+                array_mapper<Array_Type>::get_value(array, index) = data[index];
+        }
+};
+
+/*!
+ * A const array cannot be modified.
+ */
+template<typename Array>
+struct array_bulk_access<Array, true>
+{
+    static bool reserve(Array&, std::size_t)                                   { return false; }
+    static bool assign(Array&, const array_range<argument>&)                   { return false; }
+    static bool append_range(Array&, const array_range<argument>&)             { return false; }
+    static bool assign_from(Array&, const void*, std::size_t, const type&)     { return false; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T, typename Array_Address = wrapper_address_return_type_t<T>>
 class array_wrapper;
 
@@ -54,6 +433,9 @@ template<typename T, typename Array_Address>
 class array_wrapper : public array_wrapper_base
 {
     using Array_Type = typename detail::raw_type<Array_Address>::type;
+    using itr_access = array_iterator_access<typename std::remove_pointer<Array_Address>::type>;
+    using bulk_access = array_bulk_access<typename std::remove_pointer<Array_Address>::type>;
+    using flat_access = array_flat_access<typename std::remove_pointer<Array_Address>::type>;
     public:
         array_wrapper(const Array_Address& address)
         :   m_address_data(address)
@@ -71,6 +453,14 @@ class array_wrapper : public array_wrapper_base
         type get_rank_type(std::size_t index) const { return array_accessor<Array_Type>::get_ranke_type(index); }
         type get_type()                       const { return type::get<Array_Type>(); }
         bool is_raw_array()                   const { return std::is_array<Array_Type>::value; }
+        bool is_contiguous()                  const { return is_contiguous_array<Array_Type>::value; }
+        bool is_read_only()                   const { return std::is_const<typename std::remove_pointer<Array_Address>::type>::value; }
+        std::size_t get_element_size()        const { return sizeof(typename array_mapper<Array_Type>::sub_type); }
+
+        void* get_data() const
+        {
+            return get_data_impl(is_contiguous_array<Array_Type>());
+        }
 
         /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -86,7 +476,7 @@ class array_wrapper : public array_wrapper_base
         {
             return array_accessor<Array_Type>::get_size(*m_address_data, index_1, index_2);
         }
-        std::size_t get_size_variadic(const std::vector<std::size_t>& index_list) const
+        std::size_t get_size_variadic(const index_list_view& index_list) const
         {
             return array_accessor<Array_Type>::get_size(*m_address_data, index_list);
         }
@@ -105,7 +495,7 @@ class array_wrapper : public array_wrapper_base
         {
             return array_accessor<Array_Type>::set_size(*m_address_data, new_size, index_1, index_2);
         }
-        bool set_size_variadic(std::size_t new_size, const std::vector<std::size_t>& index_list)
+        bool set_size_variadic(std::size_t new_size, const index_list_view& index_list)
         {
             return array_accessor<Array_Type>::set_size(*m_address_data, new_size, index_list);
         }
@@ -131,7 +521,7 @@ class array_wrapper : public array_wrapper_base
             return array_accessor<Array_Type>::set_value(*m_address_data, arg, index_1, index_2, index_3);
         }
 
-        bool set_value_variadic(const std::vector<std::size_t>& index_list, argument& arg)
+        bool set_value_variadic(const index_list_view& index_list, argument& arg)
         {
             return array_accessor<Array_Type>::set_value(*m_address_data, arg, index_list);
         }
@@ -153,7 +543,7 @@ class array_wrapper : public array_wrapper_base
             return array_accessor<Array_Type>::get_value(*m_address_data, index_1, index_2, index_3);
         }
 
-        variant get_value_variadic(const std::vector<std::size_t>& index_list) const
+        variant get_value_variadic(const index_list_view& index_list) const
         {
             return array_accessor<Array_Type>::get_value(*m_address_data, index_list);
         }
@@ -182,7 +572,7 @@ class array_wrapper : public array_wrapper_base
             return array_accessor<Array_Type>::insert_value(*m_address_data, arg, index_1, index_2, index_3);
         }
 
-        bool insert_value_variadic(const std::vector<std::size_t>& index_list, argument& arg)
+        bool insert_value_variadic(const index_list_view& index_list, argument& arg)
         {
             return array_accessor<Array_Type>::insert_value(*m_address_data, arg, index_list);
         }
@@ -203,14 +593,108 @@ class array_wrapper : public array_wrapper_base
         {
             return array_accessor<Array_Type>::remove_value(*m_address_data, index_1, index_2, index_3);
         }
-        bool remove_value_variadic(const std::vector<std::size_t>& index_list)
+        bool remove_value_variadic(const index_list_view& index_list)
         {
             return array_accessor<Array_Type>::remove_value(*m_address_data, index_list);
         }
 
-        std::unique_ptr<array_wrapper_base> clone() const
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        void begin(iterator_data& itr) const
+        {
+            itr_access::begin(*m_address_data, itr);
+        }
+
+        void end(iterator_data& itr) const
+        {
+            itr_access::end(*m_address_data, itr);
+        }
+
+        void copy(iterator_data& itr_tgt, const iterator_data& itr_src) const
+        {
+            itr_access::itr_wrapper::create(itr_tgt, itr_src);
+        }
+
+        void destroy(iterator_data& itr) const
+        {
+            itr_access::itr_wrapper::destroy(itr);
+        }
+
+        void advance(iterator_data& itr) const
+        {
+            itr_access::advance(*m_address_data, itr);
+        }
+
+        bool equal(const iterator_data& lhs_itr, const iterator_data& rhs_itr) const
+        {
+            return itr_access::itr_wrapper::equal(lhs_itr, rhs_itr);
+        }
+
+        variant get_value(const iterator_data& itr) const
+        {
+            return itr_access::get_value(*m_address_data, itr);
+        }
+
+        bool set_value(const iterator_data& itr, argument& arg)
+        {
+            return itr_access::set_value(*m_address_data, itr, arg);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t get_flat_size() const
+        {
+            return flat_access::get_size(*m_address_data);
+        }
+
+        variant get_flat_value(std::size_t index) const
+        {
+            return flat_access::get_value(*m_address_data, index);
+        }
+
+        bool set_flat_value(std::size_t index, argument& arg)
+        {
+            return flat_access::set_value(*m_address_data, index, arg);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        bool reserve(std::size_t new_capacity)
+        {
+            return bulk_access::reserve(*m_address_data, new_capacity);
+        }
+
+        bool assign(const array_range<argument>& values)
+        {
+            return bulk_access::assign(*m_address_data, values);
+        }
+
+        bool append_range(const array_range<argument>& values)
+        {
+            return bulk_access::append_range(*m_address_data, values);
+        }
+
+        bool assign_from(const void* data, std::size_t count, const type& element_type)
+        {
+            return bulk_access::assign_from(*m_address_data, data, count, element_type);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////
+
+        void clone(array_wrapper_storage& storage) const
+        {
+            new (&storage) array_wrapper<T, Array_Address>(m_address_data);
+        }
+
+    private:
+        void* get_data_impl(std::true_type) const
+        {
+            return const_cast<void*>(get_contiguous_address(*m_address_data));
+        }
+
+        void* get_data_impl(std::false_type) const
         {
-            return detail::make_unique<array_wrapper<T, Array_Address>>(m_address_data);
+            return nullptr;
         }
 
     private:
@@ -29,9 +29,14 @@
 #define RTTR_ARRAY_WRAPPER_BASE_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/iterator_wrapper.h"
+#include "rttr/array_range.h"
+#include "rttr/detail/array/array_index_list.h"
 
 #include <vector>
 #include <cstddef>
+#include <new>
+#include <type_traits>
 
 namespace rttr
 {
@@ -43,6 +48,12 @@ class argument;
 namespace detail
 {
 
+/*!
+ * Every array wrapper stores only the address of the array, so it fits into this small buffer.
+ * The \ref variant_array_view keeps its wrapper inline in such a buffer, without any heap allocation.
+ */
+using array_wrapper_storage = std::aligned_storage<sizeof(void*) * 2, std::alignment_of<void*>::value>::type;
+
 class RTTR_API array_wrapper_base
 {
     public:
@@ -54,41 +65,63 @@ class RTTR_API array_wrapper_base
         virtual type        get_rank_type(std::size_t index) const { return get_invalid_type(); }
         virtual type        get_type() const    { return get_invalid_type(); }
         virtual bool        is_raw_array() const { return false; }
+        virtual bool        is_contiguous() const { return false; }
+        virtual bool        is_read_only() const { return true; }
+        virtual void*       get_data() const    { return nullptr; }
+        virtual std::size_t get_element_size() const { return 0; }
 
         virtual std::size_t get_size() const    { return 0; }
         virtual std::size_t get_size(std::size_t index_1) const { return 0; }
         virtual std::size_t get_size(std::size_t index_1, std::size_t index_2) const { return 0; }
-        virtual std::size_t get_size_variadic(const std::vector<std::size_t>& index_list) const { return 0; }
+        virtual std::size_t get_size_variadic(const index_list_view& index_list) const { return 0; }
 
         virtual bool set_size(std::size_t new_size) { return false; }
         virtual bool set_size(std::size_t new_size, std::size_t index_1) { return false; }
         virtual bool set_size(std::size_t new_size, std::size_t index_1, std::size_t index_2) { return false; }
-        virtual bool set_size_variadic(std::size_t new_size, const std::vector<std::size_t>& index_list) { return false; }
+        virtual bool set_size_variadic(std::size_t new_size, const index_list_view& index_list) { return false; }
 
         virtual bool set_value(argument& arg) { return false; }
         virtual bool set_value(std::size_t index_1, argument& arg) { return false; }
         virtual bool set_value(std::size_t index_1, std::size_t index_2, argument& arg) { return false; }
         virtual bool set_value(std::size_t index_1, std::size_t index_2, std::size_t index_3, argument& arg) { return false; }
-        virtual bool set_value_variadic(const std::vector<std::size_t>& index_list, argument& arg) { return false; }
+        virtual bool set_value_variadic(const index_list_view& index_list, argument& arg) { return false; }
 
         virtual variant get_value(std::size_t index_1) const { return variant(); }
         virtual variant get_value(std::size_t index_1, std::size_t index_2) const { return variant(); }
         virtual variant get_value(std::size_t index_1, std::size_t index_2, std::size_t index_3) const { return variant(); }
-        virtual variant get_value_variadic(const std::vector<std::size_t>& index_list) const { return variant(); }
+        virtual variant get_value_variadic(const index_list_view& index_list) const { return variant(); }
 
         virtual variant get_value_as_ref(std::size_t index_1) const { return variant(); }
 
         virtual bool insert_value(std::size_t index_1, argument& arg) { return false; }
         virtual bool insert_value(std::size_t index_1, std::size_t index_2, argument& arg) { return false; }
         virtual bool insert_value(std::size_t index_1, std::size_t index_2, std::size_t index_3, argument& arg) { return false; }
-        virtual bool insert_value_variadic(const std::vector<std::size_t>& index_list, argument& arg) { return false; }
+        virtual bool insert_value_variadic(const index_list_view& index_list, argument& arg) { return false; }
 
         virtual bool remove_value(std::size_t index_1) { return false; }
         virtual bool remove_value(std::size_t index_1, std::size_t index_2) { return false; }
         virtual bool remove_value(std::size_t index_1, std::size_t index_2, std::size_t index_3) { return false; }
-        virtual bool remove_value_variadic(const std::vector<std::size_t>& index_list) { return false; }
-
-        virtual std::unique_ptr<array_wrapper_base> clone() const { return detail::make_unique<array_wrapper_base>(); }
+        virtual bool remove_value_variadic(const index_list_view& index_list) { return false; }
+
+        virtual void begin(iterator_data& itr) const { }
+        virtual void end(iterator_data& itr) const { }
+        virtual void copy(iterator_data& itr_tgt, const iterator_data& itr_src) const { }
+        virtual void destroy(iterator_data& itr) const { }
+        virtual void advance(iterator_data& itr) const { }
+        virtual bool equal(const iterator_data& lhs_itr, const iterator_data& rhs_itr) const { return true; }
+        virtual variant get_value(const iterator_data& itr) const { return variant(); }
+        virtual bool set_value(const iterator_data& itr, argument& arg) { return false; }
+
+        virtual std::size_t get_flat_size() const { return 0; }
+        virtual variant get_flat_value(std::size_t index) const { return variant(); }
+        virtual bool set_flat_value(std::size_t index, argument& arg) { return false; }
+
+        virtual bool reserve(std::size_t new_capacity) { return false; }
+        virtual bool assign(const array_range<argument>& values) { return false; }
+        virtual bool append_range(const array_range<argument>& values) { return false; }
+        virtual bool assign_from(const void* data, std::size_t count, const type& element_type) { return false; }
+
+        virtual void clone(array_wrapper_storage& storage) const { new (&storage) array_wrapper_base(); }
 };
 
 } // end namespace detail
@@ -29,6 +29,7 @@
 #define RTTR_CORE_PREREQUISITES_H_
 
 #include "rttr/detail/base/version.h"
+#include "rttr/detail/base/build_config.h"
 
 namespace rttr
 {
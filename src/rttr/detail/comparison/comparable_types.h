@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/string_view.h"
+#include "rttr/interned_string.h"
 
 #include <type_traits>
 #include <cstring>
@@ -44,6 +45,7 @@ namespace detail
 template<typename T>
 using is_comparable_type = std::integral_constant<bool, std::is_same<T, std::string>::value ||
                                                         std::is_same<T, string_view>::value ||
+                                                        std::is_same<T, interned_string>::value ||
                                                         std::is_arithmetic<T>::value ||
                                                         std::is_enum<T>::value ||
                                                         std::is_same<T, std::nullptr_t>::value
@@ -105,6 +105,10 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
+
         template<typename... TArgs>
         static RTTR_FORCE_INLINE
         enable_if_t< are_args_in_valid_range<type_list<Ctor_Args...>, type_list<TArgs...>>::value, variant>
@@ -205,6 +209,10 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
 
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
+
         variant invoke() const
         {
            return method_accessor<F, Policy>::invoke(m_creator_func, instance());
@@ -281,6 +289,9 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>(); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         template<typename... TArgs>
         static RTTR_FORCE_INLINE
@@ -374,6 +385,9 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         std::vector<bool> get_is_const()                    const RTTR_NOEXCEPT { return method_accessor<F, Policy>::get_is_const();      }
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>(); }
         variant get_metadata(const variant& key)            const RTTR_NOEXCEPT { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const RTTR_NOEXCEPT { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke() const
         {
@@ -26,6 +26,7 @@
 *************************************************************************************/
 
 #include "rttr/detail/constructor/constructor_wrapper_base.h"
+#include "rttr/detail/misc/utility.h"
 
 using namespace std;
 
@@ -152,6 +153,34 @@ variant constructor_wrapper_base::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant constructor_wrapper_base::get_metadata(const interned_string& key) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t constructor_wrapper_base::get_metadata_count() const RTTR_NOEXCEPT
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t constructor_wrapper_base::get_sizeof() const RTTR_NOEXCEPT
+{
+    return sizeof(*this);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t constructor_wrapper_base::get_allocated_size() const RTTR_NOEXCEPT
+{
+    return detail::get_allocated_size(m_signature);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant constructor_wrapper_base::invoke() const
 {
     return variant();
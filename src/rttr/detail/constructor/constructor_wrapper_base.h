@@ -68,6 +68,10 @@ class RTTR_API constructor_wrapper_base
         virtual std::vector<bool> get_is_const() const RTTR_NOEXCEPT;
         virtual array_range<parameter_info> get_parameter_infos() const RTTR_NOEXCEPT;
         virtual variant get_metadata(const variant& key) const;
+        virtual variant get_metadata(const interned_string& key) const;
+        virtual std::size_t get_metadata_count() const RTTR_NOEXCEPT;
+        virtual std::size_t get_sizeof() const RTTR_NOEXCEPT;
+        std::size_t get_allocated_size() const RTTR_NOEXCEPT;
 
         virtual variant invoke() const;
         virtual variant invoke(argument& arg1) const;
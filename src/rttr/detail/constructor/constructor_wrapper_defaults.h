@@ -94,6 +94,9 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
         array_range<parameter_info> get_parameter_infos() const RTTR_NOEXCEPT { return array_range<parameter_info>(m_param_info_list.data(),
                                                                                                                    m_param_info_list.size()); }
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke() const
         {
@@ -176,6 +179,9 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>(m_param_info_list.data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const RTTR_NOEXCEPT { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const RTTR_NOEXCEPT { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke() const
         {
@@ -258,6 +264,9 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
 
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>(); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke() const
         {
@@ -335,6 +344,9 @@ class constructor_wrapper<ClassType, return_func, Acc_Level, Policy,
         std::vector<bool> get_is_const()                    const RTTR_NOEXCEPT { return method_accessor<F, Policy>::get_is_const();          }
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>();                       }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke() const
         {
@@ -0,0 +1,133 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_CONVERSION_KIND_H_
+#define RTTR_CONVERSION_KIND_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/std_type_traits.h"
+#include "rttr/interned_string.h"
+#include "rttr/string_view.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Classifies a type for the built-in conversions of \ref variant.
+ *
+ * The first entries till \p INTERNED_STRING are valid conversion targets,
+ * all entries till \p ENUM_UINT64 are valid conversion sources.
+ * A \ref string_view can only be a source, because it cannot own the converted characters.
+ * The enum entries are ordered like the corresponding underlying types.
+ */
+enum class conversion_kind : uint8_t
+{
+    BOOL,
+    CHAR,
+    INT8,
+    INT16,
+    INT32,
+    INT64,
+    UINT8,
+    UINT16,
+    UINT32,
+    UINT64,
+    FLOAT,
+    DOUBLE,
+    STRING,
+    INTERNED_STRING,
+    STRING_VIEW,
+    ENUM_BOOL,
+    ENUM_CHAR,
+    ENUM_INT8,
+    ENUM_INT16,
+    ENUM_INT32,
+    ENUM_INT64,
+    ENUM_UINT8,
+    ENUM_UINT16,
+    ENUM_UINT32,
+    ENUM_UINT64,
+    NONE
+};
+
+RTTR_STATIC_CONSTEXPR std::size_t conversion_target_count = static_cast<std::size_t>(conversion_kind::INTERNED_STRING) + 1;
+RTTR_STATIC_CONSTEXPR std::size_t conversion_source_count = static_cast<std::size_t>(conversion_kind::ENUM_UINT64) + 1;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Enable = void>
+struct conversion_kind_of : std::integral_constant<conversion_kind, conversion_kind::NONE> {};
+
+template<> struct conversion_kind_of<bool>            : std::integral_constant<conversion_kind, conversion_kind::BOOL>            {};
+template<> struct conversion_kind_of<char>            : std::integral_constant<conversion_kind, conversion_kind::CHAR>            {};
+template<> struct conversion_kind_of<int8_t>          : std::integral_constant<conversion_kind, conversion_kind::INT8>            {};
+template<> struct conversion_kind_of<int16_t>         : std::integral_constant<conversion_kind, conversion_kind::INT16>           {};
+template<> struct conversion_kind_of<int32_t>         : std::integral_constant<conversion_kind, conversion_kind::INT32>           {};
+template<> struct conversion_kind_of<int64_t>         : std::integral_constant<conversion_kind, conversion_kind::INT64>           {};
+template<> struct conversion_kind_of<uint8_t>         : std::integral_constant<conversion_kind, conversion_kind::UINT8>           {};
+template<> struct conversion_kind_of<uint16_t>        : std::integral_constant<conversion_kind, conversion_kind::UINT16>          {};
+template<> struct conversion_kind_of<uint32_t>        : std::integral_constant<conversion_kind, conversion_kind::UINT32>          {};
+template<> struct conversion_kind_of<uint64_t>        : std::integral_constant<conversion_kind, conversion_kind::UINT64>          {};
+template<> struct conversion_kind_of<float>           : std::integral_constant<conversion_kind, conversion_kind::FLOAT>           {};
+template<> struct conversion_kind_of<double>          : std::integral_constant<conversion_kind, conversion_kind::DOUBLE>          {};
+template<> struct conversion_kind_of<std::string>     : std::integral_constant<conversion_kind, conversion_kind::STRING>          {};
+template<> struct conversion_kind_of<interned_string> : std::integral_constant<conversion_kind, conversion_kind::INTERNED_STRING> {};
+template<> struct conversion_kind_of<string_view>     : std::integral_constant<conversion_kind, conversion_kind::STRING_VIEW>     {};
+
+template<typename T, conversion_kind Underlying_Kind = conversion_kind_of<typename std::underlying_type<T>::type>::value>
+using enum_conversion_kind = std::integral_constant<conversion_kind, (Underlying_Kind <= conversion_kind::UINT64 ?
+                                                                      static_cast<conversion_kind>(static_cast<uint8_t>(conversion_kind::ENUM_BOOL) +
+                                                                                                   static_cast<uint8_t>(Underlying_Kind)) :
+                                                                      conversion_kind::NONE)>;
+
+template<typename T>
+struct conversion_kind_of<T, enable_if_t<std::is_enum<T>::value>> : enum_conversion_kind<T> {};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns `true`, when the given \p kind is one of the string types; otherwise `false`.
+ */
+RTTR_INLINE bool is_string_conversion_kind(conversion_kind kind) RTTR_NOEXCEPT
+{
+    return (kind == conversion_kind::STRING || kind == conversion_kind::INTERNED_STRING || kind == conversion_kind::STRING_VIEW);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_CONVERSION_KIND_H_
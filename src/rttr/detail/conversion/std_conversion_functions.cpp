@@ -25,311 +25,1004 @@
 *                                                                                   *
 *************************************************************************************/
 
+
 #include "rttr/detail/conversion/std_conversion_functions.h"
 
 #include "rttr/detail/conversion/number_conversion.h"
 
-#include <sstream>
-#include <locale>
 #include <limits>
-#include <algorithm>
-#include <climits>
-#include <iomanip>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <cerrno>
+#include <cstdint>
 
 namespace rttr
 {
 namespace detail
 {
+
+/////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// character helpers, which are independent of the current locale
 
-template<typename T>
-std::string to_string_impl(T value, bool* ok)
+static RTTR_INLINE bool is_space(char c)
+{
+    return (c == ' ' || (c >= '\t' && c <= '\r'));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE bool is_digit(char c)
+{
+    return (c >= '0' && c <= '9');
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE char to_lower(char c)
+{
+    return ((c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE const char* skip_space(const char* itr, const char* end)
+{
+    while (itr != end && is_space(*itr))
+        ++itr;
+
+    return itr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Compares the range [itr, end) case insensitive with the given lower case \p literal.
+ */
+static bool equals_literal(const char* itr, const char* end, const char* literal)
 {
-    try
+    for (; itr != end && *literal != '\0'; ++itr, ++literal)
     {
-        std::string text = std::to_string(value);
-        if (ok)
-            *ok = true;
-        return text;
+        if (to_lower(*itr) != *literal)
+            return false;
     }
-    catch (...)
+
+    return (itr == end && *literal == '\0');
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Same as \ref equals_literal, but every white space character inside the range [itr, end) is ignored.
+ */
+static bool equals_literal_ignore_space(const char* itr, const char* end, const char* literal)
+{
+    for (; itr != end; ++itr)
     {
-        if (ok)
-            *ok = false;
-        return std::string();
+        if (is_space(*itr))
+            continue;
+
+        if (*literal == '\0' || to_lower(*itr) != *literal)
+            return false;
+
+        ++literal;
     }
+
+    return (*literal == '\0');
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// integer formatting
 
-std::string to_string(int value, bool* ok)
+/*!
+ * Writes the decimal digits of \p value backwards, beginning at \p end.
+ * Returns a pointer to the first written character.
+ */
+template<typename T>
+static RTTR_INLINE char* write_unsigned_backwards(T value, char* end)
 {
-    return to_string_impl(value, ok);
+    do
+    {
+        *--end = static_cast<char>('0' + static_cast<char>(value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    return end;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(long value, bool* ok)
+template<typename T>
+static RTTR_INLINE typename std::enable_if<std::is_signed<T>::value, char*>::type
+write_integer_backwards(T value, char* end)
 {
-    return to_string_impl(value, ok);
+    using unsigned_type = typename std::make_unsigned<T>::type;
+    if (value < 0)
+    {
+        char* begin = write_unsigned_backwards(static_cast<unsigned_type>(unsigned_type(0) - static_cast<unsigned_type>(value)), end);
+        *--begin = '-';
+        return begin;
+    }
+
+    return write_unsigned_backwards(static_cast<unsigned_type>(value), end);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(long long value, bool* ok)
+template<typename T>
+static RTTR_INLINE typename std::enable_if<!std::is_signed<T>::value, char*>::type
+write_integer_backwards(T value, char* end)
 {
-    return to_string_impl(value, ok);
+    return write_unsigned_backwards(value, end);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(unsigned value, bool* ok)
+template<typename T>
+std::string to_string_impl(T value, bool* ok)
 {
-    return to_string_impl(value, ok);
+    // digits10 + 1 digits, one sign character
+    char buffer[std::numeric_limits<T>::digits10 + 2];
+    char* const end = buffer + sizeof(buffer);
+    const char* begin = write_integer_backwards(value, end);
+
+    if (ok)
+        *ok = true;
+
+    return std::string(begin, static_cast<std::size_t>(end - begin));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// floating point formatting
+//
+// The shortest decimal representation, which round trips to the same binary value,
+// is calculated with the Grisu2 algorithm from:
+// Loitsch, Florian. "Printing floating-point numbers quickly and accurately with integers."
+// ACM Sigplan Notices 45.6 (2010): 233-243.
 
-std::string to_string(unsigned long value, bool* ok)
+struct diy_fp
 {
-    return to_string_impl(value, ok);
+    uint64_t f;
+    int      e;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE diy_fp operator-(const diy_fp& lhs, const diy_fp& rhs)
+{
+    return {lhs.f - rhs.f, lhs.e};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(unsigned long long value, bool* ok)
+static RTTR_INLINE diy_fp operator*(const diy_fp& lhs, const diy_fp& rhs)
 {
-    return to_string_impl(value, ok);
+    const uint64_t mask_32 = 0xFFFFFFFFULL;
+    const uint64_t a = lhs.f >> 32;
+    const uint64_t b = lhs.f & mask_32;
+    const uint64_t c = rhs.f >> 32;
+    const uint64_t d = rhs.f & mask_32;
+    const uint64_t ac = a * c;
+    const uint64_t bc = b * c;
+    const uint64_t ad = a * d;
+    const uint64_t bd = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & mask_32) + (bc & mask_32);
+    tmp += 1ULL << 31; // round
+    return {ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), lhs.e + rhs.e + 64};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(float value, bool* ok)
+static RTTR_INLINE diy_fp normalize(diy_fp value)
 {
-    try
+    while ((value.f & (1ULL << 63)) == 0)
     {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<float>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
+        value.f <<= 1;
+        --value.e;
     }
-    catch (...)
+
+    return value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct ieee_traits;
+
+template<>
+struct ieee_traits<double>
+{
+    using bits_type = uint64_t;
+    static RTTR_CONSTEXPR_OR_CONST int significand_size = 52;
+    static RTTR_CONSTEXPR_OR_CONST int exponent_bias = 0x3FF + significand_size;
+    static RTTR_CONSTEXPR_OR_CONST bits_type exponent_mask = 0x7FF;
+};
+
+template<>
+struct ieee_traits<float>
+{
+    using bits_type = uint32_t;
+    static RTTR_CONSTEXPR_OR_CONST int significand_size = 23;
+    static RTTR_CONSTEXPR_OR_CONST int exponent_bias = 0x7F + significand_size;
+    static RTTR_CONSTEXPR_OR_CONST bits_type exponent_mask = 0xFF;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Decomposes the positive, finite number \p value into the normalized \p w
+ * and its normalized neighbor boundaries \p m_minus and \p m_plus.
+ * All three numbers share the same exponent.
+ */
+template<typename T>
+static void get_normalized_boundaries(T value, diy_fp& w, diy_fp& m_minus, diy_fp& m_plus)
+{
+    using traits = ieee_traits<T>;
+    typename traits::bits_type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+
+    const uint64_t hidden_bit  = 1ULL << traits::significand_size;
+    const uint64_t significand = bits & (hidden_bit - 1);
+    const int biased_exponent  = static_cast<int>((bits >> traits::significand_size) & traits::exponent_mask);
+
+    diy_fp v;
+    if (biased_exponent != 0)
+        v = {significand + hidden_bit, biased_exponent - traits::exponent_bias};
+    else
+        v = {significand, 1 - traits::exponent_bias};
+
+    // the lower boundary is closer, when the significand is a power of two
+    const bool lower_boundary_is_closer = (significand == 0 && biased_exponent > 1);
+
+    m_plus  = normalize({(v.f << 1) + 1, v.e - 1});
+    m_minus = lower_boundary_is_closer ? diy_fp{(v.f << 2) - 1, v.e - 2} : diy_fp{(v.f << 1) - 1, v.e - 1};
+    m_minus.f <<= m_minus.e - m_plus.e;
+    m_minus.e = m_plus.e;
+    w = normalize(v);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns a cached power of ten c_k = f * 2^e, where the exponent e of the product
+ * with a normalized number of exponent \p e is in the range [-60, -32].
+ * The decimal exponent k is returned in \p k.
+ */
+static diy_fp get_cached_power(int e, int& k)
+{
+    // 10^-348, 10^-340, ..., 10^340
+    static const uint64_t cached_powers_f[] =
     {
-        if (ok)
-            *ok = false;
-        return std::string();
-    }
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+    };
+
+    static const int16_t cached_powers_e[] =
+    {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007,  -980,
+     -954,  -927,  -901,  -874,  -847,  -821,  -794,  -768,  -741,  -715,
+     -688,  -661,  -635,  -608,  -582,  -555,  -529,  -502,  -475,  -449,
+     -422,  -396,  -369,  -343,  -316,  -289,  -263,  -236,  -210,  -183,
+     -157,  -130,  -103,   -77,   -50,   -24,     3,    30,    56,    83,
+      109,   136,   162,   189,   216,   242,   269,   295,   322,   348,
+      375,   402,   428,   455,   481,   508,   534,   561,   588,   614,
+      641,   667,   694,   720,   747,   774,   800,   827,   853,   880,
+      907,   933,   960,   986,  1013,  1039,  1066
+    };
+
+    // k = ceil((-61 - e) * log10(2)), offset by 347 in order to stay positive
+    const double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int index_k = static_cast<int>(dk);
+    if (dk - index_k > 0.0)
+        ++index_k;
+
+    const std::size_t index = static_cast<std::size_t>((index_k >> 3) + 1);
+    k = -(-348 + static_cast<int>(index << 3));
+
+    return {cached_powers_f[index], cached_powers_e[index]};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-std::string to_string(double value, bool* ok)
+static RTTR_INLINE void grisu_round(char* buffer, int length, uint64_t delta, uint64_t rest,
+                                    uint64_t ten_kappa, uint64_t wp_w)
 {
-    try
+    while (rest < wp_w && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w))
     {
-        std::stringstream ss;
-        ss << std::setprecision(std::numeric_limits<double>::digits10) << value;
-        if (ok)
-            *ok = true;
-        return ss.str();
+        buffer[length - 1]--;
+        rest += ten_kappa;
     }
-    catch (...)
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_INLINE int count_decimal_digits(uint32_t n)
+{
+    int count = 1;
+    while (n >= 10)
     {
-        if (ok)
-            *ok = false;
-        return std::string();
+        n /= 10;
+        ++count;
     }
+
+    return count;
 }
 
-/////////////////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
-bool string_to_bool(std::string text, bool* ok)
+static void digit_gen(const diy_fp& w, const diy_fp& m_plus, uint64_t delta, char* buffer, int& length, int& k)
 {
-    std::transform(text.begin(), text.end(), text.begin(), ::tolower);
-    text.erase( std::remove_if( text.begin(), text.end(), []( char ch ) { return std::isspace<char>( ch, std::locale::classic() ); } ), text.end() );
+    static const uint32_t pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+    const diy_fp one = {1ULL << -m_plus.e, m_plus.e};
+    const diy_fp wp_w = m_plus - w;
+    uint32_t p1 = static_cast<uint32_t>(m_plus.f >> -one.e);
+    uint64_t p2 = m_plus.f & (one.f - 1);
+    int kappa = count_decimal_digits(p1);
+    length = 0;
 
-    if (text == "false" || text == "0" || text.empty())
+    while (kappa > 0)
     {
-        if (ok)
-            *ok = true;
-        return false;
+        const uint32_t d = p1 / pow10[kappa - 1];
+        p1 %= pow10[kappa - 1];
+        if (d || length)
+            buffer[length++] = static_cast<char>('0' + d);
+
+        --kappa;
+        const uint64_t rest = (static_cast<uint64_t>(p1) << -one.e) + p2;
+        if (rest <= delta)
+        {
+            k += kappa;
+            grisu_round(buffer, length, delta, rest, static_cast<uint64_t>(pow10[kappa]) << -one.e, wp_w.f);
+            return;
+        }
     }
 
-    if (ok)
-        *ok = true;
+    for (;;)
+    {
+        p2 *= 10;
+        delta *= 10;
+        const char d = static_cast<char>(p2 >> -one.e);
+        if (d || length)
+            buffer[length++] = static_cast<char>('0' + d);
 
-    return true;
+        p2 &= one.f - 1;
+        --kappa;
+        if (p2 < delta)
+        {
+            k += kappa;
+            const int index = -kappa;
+            grisu_round(buffer, length, delta, p2, one.f, wp_w.f * (index < 10 ? pow10[index] : 0));
+            return;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes the shortest digit sequence of the positive, finite \p value into \p buffer,
+ * so that: value == buffer * 10^k
+ */
+template<typename T>
+static void grisu2(T value, char* buffer, int& length, int& k)
+{
+    diy_fp w, m_minus, m_plus;
+    get_normalized_boundaries(value, w, m_minus, m_plus);
+
+    const diy_fp c_mk = get_cached_power(m_plus.e, k);
+    const diy_fp W = w * c_mk;
+    diy_fp Wp = m_plus * c_mk;
+    diy_fp Wm = m_minus * c_mk;
+    ++Wm.f;
+    --Wp.f;
+    digit_gen(W, Wp, Wp.f - Wm.f, buffer, length, k);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-int string_to_int(const std::string& source, bool* ok)
+/*!
+ * Formats the given digits, with value == digits * 10^k, like the printf format '%g'
+ * with a precision of max_digits10, but without trailing zeros.
+ */
+static char* format_digits(const char* digits, int length, int k, int precision, char* itr)
 {
-    try
+    const int exponent = length + k - 1;
+
+    if (exponent >= -4 && exponent < precision)
     {
-        std::size_t pos = 0;
-        const int value = std::stoi(source, &pos);
-        if (pos == source.length())
+        if (k >= 0)
         {
-            if (ok)
-                *ok = true;
-            return value;
+            // 1234e2 -> 123400
+            std::memcpy(itr, digits, static_cast<std::size_t>(length));
+            itr += length;
+            for (int i = 0; i < k; ++i)
+                *itr++ = '0';
+        }
+        else if (exponent >= 0)
+        {
+            // 1234e-2 -> 12.34
+            std::memcpy(itr, digits, static_cast<std::size_t>(exponent + 1));
+            itr += exponent + 1;
+            *itr++ = '.';
+            std::memcpy(itr, digits + exponent + 1, static_cast<std::size_t>(length - exponent - 1));
+            itr += length - exponent - 1;
+        }
+        else
+        {
+            // 1234e-6 -> 0.001234
+            *itr++ = '0';
+            *itr++ = '.';
+            for (int i = -1; i > exponent; --i)
+                *itr++ = '0';
+            std::memcpy(itr, digits, static_cast<std::size_t>(length));
+            itr += length;
         }
     }
-    catch (...)
+    else
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        // 1234e30 -> 1.234e+33
+        *itr++ = digits[0];
+        if (length > 1)
+        {
+            *itr++ = '.';
+            std::memcpy(itr, digits + 1, static_cast<std::size_t>(length - 1));
+            itr += length - 1;
+        }
+
+        *itr++ = 'e';
+        *itr++ = (exponent < 0) ? '-' : '+';
+        const unsigned int abs_exponent = static_cast<unsigned int>(exponent < 0 ? -exponent : exponent);
+        char exp_buffer[4];
+        char* const exp_end = exp_buffer + sizeof(exp_buffer);
+        const char* exp_begin = write_unsigned_backwards(abs_exponent, exp_end);
+        if (abs_exponent < 10)
+            *itr++ = '0';
+        while (exp_begin != exp_end)
+            *itr++ = *exp_begin++;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    return itr;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-unsigned long string_to_ulong(const std::string& source, bool* ok)
+template<typename T>
+std::string floating_point_to_string(T value, bool* ok)
 {
-    try
+    if (ok)
+        *ok = true;
+
+    if (value != value)
+        return std::string("nan");
+
+    char buffer[64];
+    char* itr = buffer;
+    if (std::signbit(value))
     {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        unsigned long result = 0;
-        if (pos == source.length() && convert_to(value, result))
-        {
-            if (ok)
-                *ok = true;
-            return result;
-        }
+        *itr++ = '-';
+        value = -value;
     }
-    catch (...)
+
+    if (value == std::numeric_limits<T>::infinity())
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        std::memcpy(itr, "inf", 3);
+        return std::string(buffer, itr + 3);
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    if (value == T(0))
+    {
+        *itr++ = '0';
+        return std::string(buffer, itr);
+    }
+
+    char digits[24];
+    int length = 0;
+    int k = 0;
+    grisu2(value, digits, length, k);
+
+    while (length > 1 && digits[length - 1] == '0')
+    {
+        --length;
+        ++k;
+    }
+
+    itr = format_digits(digits, length, k, std::numeric_limits<T>::max_digits10, itr);
+    return std::string(buffer, itr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// integer parsing
 
-long long string_to_long_long(const std::string& source, bool* ok)
+/*!
+ * Parses the decimal digits in the range [itr, end) into \p value.
+ * Returns false, when the range contains no digit or non-digits or the value does not fit into \p T.
+ */
+template<typename T>
+static RTTR_INLINE bool parse_unsigned(const char* itr, const char* end, T& value)
 {
-    try
+    if (itr == end)
+        return false;
+
+    const T max_value = std::numeric_limits<T>::max();
+    T result = 0;
+    for (; itr != end; ++itr)
     {
-        std::size_t pos = 0;
-        const long long value = std::stoll(source, &pos);
-        if (pos == source.length())
-        {
-            if (ok)
-                *ok = true;
-            return value;
-        }
+        if (!is_digit(*itr))
+            return false;
+
+        const T digit = static_cast<T>(*itr - '0');
+        if (result > (max_value - digit) / 10)
+            return false; // value too large
+
+        result = static_cast<T>(result * 10 + digit);
     }
-    catch (...)
+
+    value = result;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Parses the integer in the range [itr, end) without throwing exceptions.
+ * Leading whitespace and an optional sign are accepted, trailing characters are not.
+ */
+template<typename T>
+static bool parse_integer(const char* itr, const char* end, T& value)
+{
+    using unsigned_type = typename std::make_unsigned<T>::type;
+
+    itr = skip_space(itr, end);
+    bool negative = false;
+    if (itr != end && (*itr == '+' || *itr == '-'))
+        negative = (*itr++ == '-');
+
+    unsigned_type result = 0;
+    if (!parse_unsigned(itr, end, result))
+        return false;
+
+    if (negative)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        if (result == 0)
+        {
+            value = 0;
+            return true;
+        }
+
+        if (!std::numeric_limits<T>::is_signed)
+            return false; // value too small
+
+        const unsigned_type min_value = static_cast<unsigned_type>(static_cast<unsigned_type>(std::numeric_limits<T>::max()) + 1);
+        if (result > min_value)
+            return false; // value too small
+
+        value = (result == min_value) ? std::numeric_limits<T>::min() : static_cast<T>(-static_cast<T>(result));
+        return true;
     }
 
+    return convert_to(result, value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE T string_to_integer(string_view source, bool* ok)
+{
+    T value = 0;
+    const bool result = parse_integer(source.data(), source.data() + source.size(), value);
     if (ok)
-        *ok = false;
-    return 0;
+        *ok = result;
+
+    return (result ? value : T(0));
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// floating point parsing
+
+template<typename T>
+struct fast_path_traits;
+
+template<>
+struct fast_path_traits<double>
+{
+    static RTTR_CONSTEXPR_OR_CONST uint64_t max_mantissa = 1ULL << 53;
+    static RTTR_CONSTEXPR_OR_CONST int max_exponent = 22;
+
+    static double to_value(const char* text, char** end) { return std::strtod(text, end); }
+};
+
+template<>
+struct fast_path_traits<float>
+{
+    static RTTR_CONSTEXPR_OR_CONST uint64_t max_mantissa = 1ULL << 24;
+    static RTTR_CONSTEXPR_OR_CONST int max_exponent = 10;
+
+    static float to_value(const char* text, char** end) { return std::strtof(text, end); }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const double exact_powers_of_ten[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
-unsigned long long string_to_ulong_long(const std::string& source, bool* ok)
+/*!
+ * Tries to calculate: value = mantissa * 10^exponent, without any rounding error.
+ */
+template<typename T>
+static RTTR_INLINE bool fast_path_to_value(uint64_t mantissa, int exponent, T& value)
 {
-    try
+    using traits = fast_path_traits<T>;
+    if (mantissa <= traits::max_mantissa && exponent >= -traits::max_exponent && exponent <= traits::max_exponent)
     {
-        std::size_t pos = 0;
-        const auto itr = std::find_if(source.begin(), source.end(), [](char c){ return !std::isdigit(c, std::locale()); });
-        if (itr == source.end())
-        {
-            const unsigned long long value = std::stoull(source, &pos);
-            if (pos == source.length())
-            {
-                if (ok)
-                    *ok = true;
-                return value;
-            }
-        }
+        // every factor is exactly representable, so the result is correctly rounded
+        const T number = static_cast<T>(mantissa);
+        if (exponent < 0)
+            value = number / static_cast<T>(exact_powers_of_ten[-exponent]);
+        else
+            value = number * static_cast<T>(exact_powers_of_ten[exponent]);
+
+        return true;
     }
-    catch (...)
+
+    if (mantissa <= fast_path_traits<double>::max_mantissa && exponent >= 0 && exponent <= fast_path_traits<double>::max_exponent)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        // when the product is an integer below 2^53, it can be calculated exactly as double
+        const double number = static_cast<double>(mantissa) * exact_powers_of_ten[exponent];
+        if (number <= static_cast<double>(fast_path_traits<double>::max_mantissa))
+        {
+            value = static_cast<T>(number);
+            return true;
+        }
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
+    return false;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-float string_to_float(const std::string& source, bool* ok)
+/*!
+ * Parses the floating point number in the range [itr, end) without throwing exceptions
+ * and independent of the current locale.
+ *
+ * The accepted format is: [whitespace][sign](digits[.digits] | .digits)[(e|E)[sign]digits]
+ * or one of the case insensitive literals "inf", "infinity" and "nan".
+ * A result which overflows or underflows to zero is reported as error.
+ */
+template<typename T>
+static bool parse_floating_point(const char* itr, const char* end, T& value)
 {
-    try
+    // significant digits, which are kept, more digits cannot influence the rounding of the result anymore
+    const int max_digits = 800;
+    char digits[max_digits + 16];
+    int digit_count     = 0;
+    int point_position  = 0;
+    bool has_digits     = false;
+    bool sticky         = false;
+
+    itr = skip_space(itr, end);
+    bool negative = false;
+    if (itr != end && (*itr == '+' || *itr == '-'))
+        negative = (*itr++ == '-');
+
+    if (itr != end && !is_digit(*itr) && *itr != '.')
     {
-        std::size_t pos = 0;
-        const float value = std::stof(source, &pos);
-        if (pos == source.length())
+        if (equals_literal(itr, end, "inf") || equals_literal(itr, end, "infinity"))
+        {
+            value = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+            return true;
+        }
+        if (equals_literal(itr, end, "nan"))
         {
-            if (ok)
-                *ok = true;
-            return value;
+            value = std::numeric_limits<T>::quiet_NaN();
+            return true;
         }
+        return false;
     }
-    catch (...)
+
+    // integer part
+    for (; itr != end && is_digit(*itr); ++itr)
     {
-        if (ok)
-            *ok = false;
-        return 0;
+        has_digits = true;
+        if (digit_count == 0 && *itr == '0')
+            continue;
+
+        if (digit_count < max_digits)
+            digits[digit_count++] = *itr;
+        else
+            sticky |= (*itr != '0');
+
+        ++point_position;
     }
 
-    if (ok)
-        *ok = false;
-    return 0;
-}
+    // fractional part
+    if (itr != end && *itr == '.')
+    {
+        for (++itr; itr != end && is_digit(*itr); ++itr)
+        {
+            has_digits = true;
+            if (digit_count == 0 && *itr == '0')
+            {
+                --point_position;
+                continue;
+            }
 
-/////////////////////////////////////////////////////////////////////////////////////////
+            if (digit_count < max_digits)
+                digits[digit_count++] = *itr;
+            else
+                sticky |= (*itr != '0');
+        }
+    }
 
-double string_to_double(const std::string& source, bool* ok)
-{
-    try
+    if (!has_digits)
+        return false;
+
+    // exponent part
+    int exponent = 0;
+    if (itr != end && (*itr == 'e' || *itr == 'E'))
     {
-        std::size_t pos = 0;
-        const double value = std::stod(source, &pos);
-        if (pos == source.length())
+        ++itr;
+        bool negative_exponent = false;
+        if (itr != end && (*itr == '+' || *itr == '-'))
+            negative_exponent = (*itr++ == '-');
+
+        if (itr == end || !is_digit(*itr))
+            return false;
+
+        for (; itr != end && is_digit(*itr); ++itr)
         {
-            if (ok)
-                *ok = true;
-            return value;
+            if (exponent < 100000)
+                exponent = exponent * 10 + (*itr - '0');
         }
+
+        if (negative_exponent)
+            exponent = -exponent;
+    }
+
+    if (itr != end)
+        return false;
+
+    if (!sticky)
+    {
+        while (digit_count > 0 && digits[digit_count - 1] == '0')
+            --digit_count;
+    }
+
+    if (digit_count == 0)
+    {
+        value = negative ? -T(0) : T(0);
+        return true;
+    }
+
+    // value = 0.digits * 10^(point_position + exponent) = digits * 10^decimal_exponent
+    const int decimal_exponent = point_position + exponent - digit_count;
+
+    if (point_position + exponent > std::numeric_limits<T>::max_exponent10 + 1)
+        return false; // value too large
+    if (point_position + exponent < std::numeric_limits<T>::min_exponent10 - std::numeric_limits<T>::max_digits10 - 1)
+        return false; // value too small
+
+    T result;
+    bool done = false;
+    if (!sticky && digit_count <= 19)
+    {
+        uint64_t mantissa = 0;
+        for (int i = 0; i < digit_count; ++i)
+            mantissa = mantissa * 10 + static_cast<uint64_t>(digits[i] - '0');
+
+        done = fast_path_to_value(mantissa, decimal_exponent, result);
     }
-    catch (...)
+
+    if (!done)
+    {
+        // Slow path: let the C library round correctly. The number is written
+        // without a decimal point, so the current locale has no influence on the result.
+        int exponent_for_text = decimal_exponent;
+        if (sticky)
+        {
+            digits[digit_count++] = '1';
+            --exponent_for_text;
+        }
+
+        char* text_end = digits + digit_count;
+        *text_end++ = 'e';
+        if (exponent_for_text < 0)
+            *text_end++ = '-';
+
+        char exp_buffer[12];
+        char* const exp_end = exp_buffer + sizeof(exp_buffer);
+        const char* exp_begin = write_unsigned_backwards(static_cast<unsigned int>(exponent_for_text < 0 ? -exponent_for_text : exponent_for_text), exp_end);
+        while (exp_begin != exp_end)
+            *text_end++ = *exp_begin++;
+        *text_end = '\0';
+
+        errno = 0;
+        result = fast_path_traits<T>::to_value(digits, nullptr);
+        if (errno == ERANGE && (result == T(0) || result == std::numeric_limits<T>::infinity()))
+            return false;
+    }
+
+    value = negative ? -result : result;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE T string_to_floating_point(string_view source, bool* ok)
+{
+    T value = 0;
+    const bool result = parse_floating_point(source.data(), source.data() + source.size(), value);
+    if (ok)
+        *ok = result;
+
+    return (result ? value : T(0));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(int value, bool* ok)
+{
+    return to_string_impl(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(long value, bool* ok)
+{
+    return to_string_impl(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(long long value, bool* ok)
+{
+    return to_string_impl(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(unsigned value, bool* ok)
+{
+    return to_string_impl(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(unsigned long value, bool* ok)
+{
+    return to_string_impl(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(unsigned long long value, bool* ok)
+{
+    return to_string_impl(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(float value, bool* ok)
+{
+    return floating_point_to_string(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string to_string(double value, bool* ok)
+{
+    return floating_point_to_string(value, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool string_to_bool(string_view text, bool* ok)
+{
+    const char* const begin = text.data();
+    const char* const end   = begin + text.size();
+    if (equals_literal_ignore_space(begin, end, "false") ||
+        equals_literal_ignore_space(begin, end, "0") ||
+        equals_literal_ignore_space(begin, end, ""))
     {
         if (ok)
-            *ok = false;
-        return 0;
+            *ok = true;
+        return false;
     }
 
     if (ok)
-        *ok = false;
+        *ok = true;
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int string_to_int(string_view source, bool* ok)
+{
+    return string_to_integer<int>(source, ok);
+}
 
-    return 0;
+/////////////////////////////////////////////////////////////////////////////////////////
+
+unsigned long string_to_ulong(string_view source, bool* ok)
+{
+    return string_to_integer<unsigned long>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+long long string_to_long_long(string_view source, bool* ok)
+{
+    return string_to_integer<long long>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+unsigned long long string_to_ulong_long(string_view source, bool* ok)
+{
+    return string_to_integer<unsigned long long>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+float string_to_float(string_view source, bool* ok)
+{
+    return string_to_floating_point<float>(source, ok);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+double string_to_double(string_view source, bool* ok)
+{
+    return string_to_floating_point<double>(source, ok);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -34,18 +34,55 @@
 #include "rttr/argument.h"
 #include "rttr/variant.h"
 #include "rttr/string_view.h"
+#include "rttr/enum_flags.h"
+#include "rttr/detail/misc/utility.h"
 
 #include <utility>
 #include <type_traits>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstdint>
 
 namespace rttr
 {
 namespace detail
 {
 
+/*!
+ * Extracts the value of an \ref enum_flags object from the given argument.
+ * \ref enum_flags can only be used for enums which fit into an `int32_t`.
+ */
+template<typename Enum_Type, bool = (sizeof(Enum_Type) <= sizeof(int32_t))>
+struct enum_flags_value
+{
+    template<typename T>
+    static RTTR_INLINE bool get(argument&, T&) { return false; }
+};
+
+template<typename Enum_Type>
+struct enum_flags_value<Enum_Type, true>
+{
+    template<typename T>
+    static RTTR_INLINE bool get(argument& arg, T& value)
+    {
+        using flags_type = enum_flags<Enum_Type>;
+        if (!arg.is_type<flags_type>())
+            return false;
+
+        value = static_cast<T>(static_cast<typename flags_type::enum_type>(arg.get_value<flags_type>()));
+        return true;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename Enum_Type, std::size_t N, std::size_t Metadata_Count>
 class enumeration_wrapper : public enumeration_wrapper_base, public metadata_handler<Metadata_Count>
 {
+    using underlying_type   = typename std::underlying_type<Enum_Type>::type;
+    using unsigned_type     = typename std::make_unsigned<underlying_type>::type;
+
     public:
         enumeration_wrapper(std::array< enum_data<Enum_Type>, N > data,
                             std::array<metadata, Metadata_Count> metadata_list) RTTR_NOEXCEPT
@@ -60,11 +97,14 @@ class enumeration_wrapper : public enumeration_wrapper_base, public metadata_han
                  ++index;
             }
             static_assert(std::is_enum<Enum_Type>::value, "No enum type provided, please create an instance of this class only for enum types!");
+
+            create_name_index();
+            create_value_index();
         }
 
         bool is_valid() const RTTR_NOEXCEPT { return true; }
         type get_type() const RTTR_NOEXCEPT { return type::get<Enum_Type>(); }
-        type get_underlying_type() const RTTR_NOEXCEPT { return type::get<typename std::underlying_type<Enum_Type>::type>(); }
+        type get_underlying_type() const RTTR_NOEXCEPT { return type::get<underlying_type>(); }
 
         array_range<string_view> get_names() const RTTR_NOEXCEPT
         {
@@ -79,43 +119,170 @@ class enumeration_wrapper : public enumeration_wrapper_base, public metadata_han
         string_view value_to_name(argument& value) const
         {
             if (!value.is_type<Enum_Type>() &&
-                !value.is_type<typename std::underlying_type<Enum_Type>::type>())
+                !value.is_type<underlying_type>())
             {
                 return string_view();
             }
 
-            const Enum_Type enum_value = value.get_value<Enum_Type>();
-            int index = 0;
-            for (const auto& item : m_enum_values)
+            const auto index = find_value(static_cast<underlying_type>(value.get_value<Enum_Type>()));
+            return (index != N ? m_enum_names[index] : string_view());
+        }
+
+        variant name_to_value(string_view name) const
+        {
+            const auto index = find_name(name);
+            if (index != N)
+                return m_enum_values[index];
+
+            return variant();
+        }
+
+        std::string value_to_flag_names(argument& value) const
+        {
+            underlying_type enum_value;
+            if (value.is_type<Enum_Type>() || value.is_type<underlying_type>())
+                enum_value = static_cast<underlying_type>(value.get_value<Enum_Type>());
+            else if (!enum_flags_value<Enum_Type>::get(value, enum_value))
+                return std::string();
+
+            // a registered name for the whole value (e.g. combined or zero values) is preferred
+            const auto index = find_value(enum_value);
+            if (index != N)
+                return m_enum_names[index].to_string();
+
+            std::string result;
+            auto remaining_bits = static_cast<unsigned_type>(enum_value);
+            while (remaining_bits != 0)
             {
-                if (item == enum_value)
-                    return m_enum_names[index];
+                const auto lowest_bit = static_cast<unsigned_type>(remaining_bits & static_cast<unsigned_type>(~remaining_bits + 1));
+                const auto bit_index = find_value(static_cast<underlying_type>(lowest_bit));
+                if (bit_index == N)
+                    return std::string();
 
-                ++index;
+                if (!result.empty())
+                    result += '|';
+
+                result.append(m_enum_names[bit_index].data(), m_enum_names[bit_index].size());
+                remaining_bits = static_cast<unsigned_type>(remaining_bits & static_cast<unsigned_type>(~lowest_bit));
             }
 
-            return string_view();
+            return result;
         }
 
-        variant name_to_value(string_view name) const
+        variant flag_names_to_value(string_view names) const
         {
-            int index = 0;
-            for (const auto& item : m_enum_names)
+            unsigned_type enum_bits = 0;
+            const char* itr = names.data();
+            const char* const end = itr + names.size();
+            while (true)
             {
-                if (item == name)
-                    return m_enum_values[index];
+                const char* separator = itr;
+                while (separator != end && *separator != '|')
+                    ++separator;
+
+                const auto index = find_name(trim(itr, separator));
+                if (index == N)
+                    return variant();
 
-                ++index;
+                enum_bits = static_cast<unsigned_type>(enum_bits | static_cast<unsigned_type>(m_enum_values[index]));
+
+                if (separator == end)
+                    break;
+
+                itr = separator + 1;
             }
-            return variant();
+
+            return static_cast<Enum_Type>(enum_bits);
         }
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+        std::size_t get_allocated_size() const RTTR_NOEXCEPT { return m_dense_value_index.capacity() * sizeof(std::size_t); }
+
+    private:
+        static string_view trim(const char* begin, const char* end) RTTR_NOEXCEPT
+        {
+            while (begin != end && *begin == ' ')
+                ++begin;
+            while (end != begin && *(end - 1) == ' ')
+                --end;
+
+            return string_view(begin, static_cast<std::size_t>(end - begin));
+        }
+
+        /*!
+         * The names are indexed by their hash value, sorted in ascending order.
+         * Names with the same hash keep the order of registration, so the first registered name wins.
+         */
+        void create_name_index()
+        {
+            for (std::size_t index = 0; index < N; ++index)
+                m_name_index[index] = {generate_hash(m_enum_names[index].data(), m_enum_names[index].size()), index};
+
+            std::sort(m_name_index.begin(), m_name_index.end());
+        }
+
+        /*!
+         * When the values are contiguous (small gaps are allowed), a dense table is created,
+         * which maps a value directly to its index. Otherwise the values are looked up via binary search.
+         */
+        void create_value_index()
+        {
+            for (std::size_t index = 0; index < N; ++index)
+                m_value_index[index] = {static_cast<underlying_type>(m_enum_values[index]), index};
+
+            std::sort(m_value_index.begin(), m_value_index.end());
+
+            if (N == 0)
+                return;
+
+            m_min_value = m_value_index.front().first;
+            const auto value_range = static_cast<uint64_t>(m_value_index.back().first) - static_cast<uint64_t>(m_min_value);
+            if (value_range >= static_cast<uint64_t>(N) * 2)
+                return;
+
+            m_dense_value_index.assign(static_cast<std::size_t>(value_range) + 1, N);
+            // iterate backwards, so the first registered index for a duplicated value is stored
+            for (auto itr = m_value_index.rbegin(); itr != m_value_index.rend(); ++itr)
+                m_dense_value_index[static_cast<std::size_t>(static_cast<uint64_t>(itr->first) - static_cast<uint64_t>(m_min_value))] = itr->second;
+        }
+
+        std::size_t find_name(string_view name) const RTTR_NOEXCEPT
+        {
+            const std::size_t hash_value = generate_hash(name.data(), name.size());
+            auto itr = std::lower_bound(m_name_index.cbegin(), m_name_index.cend(), std::make_pair(hash_value, std::size_t(0)));
+            for (; itr != m_name_index.cend() && itr->first == hash_value; ++itr)
+            {
+                if (m_enum_names[itr->second] == name)
+                    return itr->second;
+            }
+
+            return N;
+        }
+
+        std::size_t find_value(underlying_type value) const RTTR_NOEXCEPT
+        {
+            if (!m_dense_value_index.empty())
+            {
+                const auto offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(m_min_value);
+                return (offset < m_dense_value_index.size() ? m_dense_value_index[static_cast<std::size_t>(offset)] : N);
+            }
+
+            const auto itr = std::lower_bound(m_value_index.cbegin(), m_value_index.cend(), std::make_pair(value, std::size_t(0)));
+            return ((itr != m_value_index.cend() && itr->first == value) ? itr->second : N);
+        }
+
     private:
-        std::array< string_view, N >    m_enum_names;
-        std::array< Enum_Type, N >      m_enum_values;
-        std::array< variant, N >        m_enum_variant_values;
+        std::array< string_view, N >                                m_enum_names;
+        std::array< Enum_Type, N >                                  m_enum_values;
+        std::array< variant, N >                                    m_enum_variant_values;
+        std::array< std::pair<std::size_t, std::size_t>, N >        m_name_index;
+        std::array< std::pair<underlying_type, std::size_t>, N >    m_value_index;
+        std::vector<std::size_t>                                    m_dense_value_index;
+        underlying_type                                             m_min_value = underlying_type();
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
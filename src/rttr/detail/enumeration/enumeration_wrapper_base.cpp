@@ -111,6 +111,20 @@ variant enumeration_wrapper_base::name_to_value(string_view name) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::string enumeration_wrapper_base::value_to_flag_names(argument& value) const
+{
+    return std::string();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant enumeration_wrapper_base::flag_names_to_value(string_view names) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant enumeration_wrapper_base::get_metadata(const variant& key) const
 {
     return variant();
@@ -118,5 +132,33 @@ variant enumeration_wrapper_base::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant enumeration_wrapper_base::get_metadata(const interned_string& key) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t enumeration_wrapper_base::get_metadata_count() const RTTR_NOEXCEPT
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t enumeration_wrapper_base::get_sizeof() const RTTR_NOEXCEPT
+{
+    return sizeof(*this);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t enumeration_wrapper_base::get_allocated_size() const RTTR_NOEXCEPT
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
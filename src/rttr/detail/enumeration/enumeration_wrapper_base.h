@@ -72,9 +72,17 @@ class RTTR_API enumeration_wrapper_base
 
         virtual variant name_to_value(string_view name) const;
 
+        virtual std::string value_to_flag_names(argument& value) const;
+
+        virtual variant flag_names_to_value(string_view names) const;
+
         void set_declaring_type(type declaring_type) RTTR_NOEXCEPT;
 
         virtual variant get_metadata(const variant& key) const;
+        virtual variant get_metadata(const interned_string& key) const;
+        virtual std::size_t get_metadata_count() const RTTR_NOEXCEPT;
+        virtual std::size_t get_sizeof() const RTTR_NOEXCEPT;
+        virtual std::size_t get_allocated_size() const RTTR_NOEXCEPT;
     private:
         type m_declaring_type;
 };
@@ -40,7 +40,7 @@ namespace detail
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-static bool is_valid_filter_item(filter_items filter)
+static RTTR_INLINE bool is_valid_filter_item(filter_items filter)
 {
     if ((filter.test_flag(filter_item::public_access) ||
          filter.test_flag(filter_item::non_public_access)) &&
@@ -89,55 +89,25 @@ RTTR_INLINE bool filter_member_item(const T& item, const type& t, filter_items f
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-detail::default_predicate<T> get_filter_predicate(const type& t, filter_items filter)
+RTTR_INLINE bool filter_member_item(const constructor& item, const type& t, filter_items filter)
 {
-    if (!is_valid_filter_item(filter))
-    {
-        return {[](const T&){ return false; }};
-    }
-    else
+    if (filter.test_flag(filter_item::public_access) && filter.test_flag(filter_item::non_public_access))
     {
-        return {[filter, t](const T& item)
-        {
-            return filter_member_item<T>(item, t, filter);
-        }};
+        return true;
     }
-}
-
-/////////////////////////////////////////////////////////////////////////////////////////
-
-template<>
-RTTR_INLINE detail::default_predicate<constructor> get_filter_predicate(const type& t, filter_items filter)
-{
-    if (!is_valid_filter_item(filter))
+    else if (filter.test_flag(filter_item::public_access))
     {
-        return {[](const constructor&){ return false; }};
+        return (item.get_access_level() == access_levels::public_access);
     }
-    else
+    else if (filter.test_flag(filter_item::non_public_access))
     {
-        return {[filter](const constructor& item)
-        {
-            bool result = true;
-
-            if (filter.test_flag(filter_item::public_access) && filter.test_flag(filter_item::non_public_access))
-            {
-                result &= true;
-            }
-            else if (filter.test_flag(filter_item::public_access))
-            {
-                result &= (item.get_access_level() == access_levels::public_access);
-            }
-            else if (filter.test_flag(filter_item::non_public_access))
-            {
-                const auto access_level = item.get_access_level();
-                result &= (access_level == access_levels::private_access || access_level == access_levels::protected_access);
-            }
-
-            return result;
-        }};
+        const auto access_level = item.get_access_level();
+        return (access_level == access_levels::private_access || access_level == access_levels::protected_access);
     }
+
+    return true;
 }
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 } // end namespace detail
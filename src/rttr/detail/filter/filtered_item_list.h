@@ -0,0 +1,110 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_FILTERED_ITEM_LIST_H_
+#define RTTR_FILTERED_ITEM_LIST_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/filter_item.h"
+#include "rttr/array_range.h"
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Stores the items of one class for every combination of \ref filter_item flags.
+ *
+ * All filtered lists are placed one after another in one vector,
+ * so a filtered range is just a pointer range, without any predicate.
+ * The lists are rebuild during registration, every time a new item is added to the class;
+ * \p filter_func decides whether an item belongs to the list of a given filter combination.
+ */
+template<typename T>
+class filtered_item_list
+{
+    public:
+        filtered_item_list()
+        {
+            m_offsets.fill(0);
+        }
+
+        template<typename Filter_Func>
+        void update(const std::vector<T>& items, const Filter_Func& filter_func)
+        {
+            m_items.clear();
+            for (std::size_t index = 0; index < filter_combination_count; ++index)
+            {
+                m_offsets[index] = static_cast<uint32_t>(m_items.size());
+                const filter_items filter = static_cast<filter_item>(index);
+                for (const auto& item : items)
+                {
+                    if (filter_func(item, filter))
+                        m_items.push_back(item);
+                }
+            }
+            m_offsets[filter_combination_count] = static_cast<uint32_t>(m_items.size());
+        }
+
+        array_range<T> get_items(filter_items filter) const RTTR_NOEXCEPT
+        {
+            const auto index = static_cast<std::size_t>(static_cast<filter_items::enum_type>(filter)) % filter_combination_count;
+            const auto begin = m_offsets[index];
+            const auto end = m_offsets[index + 1];
+            if (begin == end)
+                return array_range<T>();
+
+            return array_range<T>(m_items.data() + begin, end - begin);
+        }
+
+        std::size_t get_allocated_size() const RTTR_NOEXCEPT
+        {
+            return (m_items.capacity() * sizeof(T));
+        }
+
+    private:
+        // the filter_item flags use five bits
+        static RTTR_CONSTEXPR_OR_CONST std::size_t filter_combination_count = 32;
+
+        std::vector<T>                                      m_items;
+        std::array<uint32_t, filter_combination_count + 1>  m_offsets;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_FILTERED_ITEM_LIST_H_
@@ -35,6 +35,16 @@
 
 namespace rttr
 {
+namespace detail
+{
+
+template<typename Predicate>
+RTTR_INLINE bool has_predicate(const Predicate& pred) RTTR_NOEXCEPT;
+
+template<typename T>
+RTTR_INLINE bool has_predicate(const default_predicate<T>& pred) RTTR_NOEXCEPT;
+
+} // end namespace detail
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -42,7 +52,8 @@ template<typename T, typename Predicate>
 RTTR_INLINE array_range<T, Predicate>::array_range(const T* begin, size_type size, const Predicate& pred)
 :   m_begin(begin),
     m_end(begin + size),
-    m_pred(pred)
+    m_pred(pred),
+    m_has_predicate(detail::has_predicate(m_pred))
 {
 }
 
@@ -51,7 +62,8 @@ RTTR_INLINE array_range<T, Predicate>::array_range(const T* begin, size_type siz
 template<typename T, typename Predicate>
 RTTR_INLINE array_range<T, Predicate>::array_range()
 :   m_begin(nullptr),
-    m_end(nullptr)
+    m_end(nullptr),
+    m_has_predicate(false)
 {
 }
 
@@ -67,7 +79,7 @@ RTTR_INLINE typename array_range<T, Predicate>::const_iterator array_range<T, Pr
     else
     {
         const_iterator itr(m_begin, this);
-        if (m_pred(*itr))
+        if (!m_has_predicate || m_pred(*itr))
             return itr;
 
         next(itr);
@@ -96,7 +108,7 @@ RTTR_INLINE typename array_range<T, Predicate>::const_iterator array_range<T, Pr
     else
     {
         const_iterator itr(m_begin, this);
-        if (m_pred(*itr))
+        if (!m_has_predicate || m_pred(*itr))
             return itr;
 
         next(itr);
@@ -125,7 +137,7 @@ RTTR_INLINE typename array_range<T, Predicate>::const_iterator array_range<T, Pr
     else
     {
         const_iterator itr(m_begin, this);
-        if (m_pred(*itr))
+        if (!m_has_predicate || m_pred(*itr))
             return itr;
 
         next(itr);
@@ -154,7 +166,7 @@ RTTR_INLINE typename array_range<T, Predicate>::const_reverse_iterator array_ran
     else
     {
         const_reverse_iterator itr(m_end - 1, this);
-        if (m_pred(*itr))
+        if (!m_has_predicate || m_pred(*itr))
             return itr;
 
         prev(itr);
@@ -183,7 +195,7 @@ RTTR_INLINE typename array_range<T, Predicate>::const_reverse_iterator array_ran
     else
     {
         const_reverse_iterator itr(m_end - 1, this);
-        if (m_pred(*itr))
+        if (!m_has_predicate || m_pred(*itr))
             return itr;
 
         prev(itr);
@@ -212,7 +224,7 @@ RTTR_INLINE typename array_range<T, Predicate>::const_reverse_iterator array_ran
     else
     {
         const_reverse_iterator itr(m_end - 1, this);
-        if (m_pred(*itr))
+        if (!m_has_predicate || m_pred(*itr))
             return itr;
 
         prev(itr);
@@ -234,6 +246,9 @@ RTTR_INLINE typename array_range<T, Predicate>::const_reverse_iterator array_ran
 template<typename T, typename Predicate>
 RTTR_INLINE size_t array_range<T, Predicate>::size() const
 {
+    if (!m_has_predicate)
+        return static_cast<std::size_t>(m_end - m_begin);
+
     std::size_t result = 0;
     const_iterator itr{m_begin, this};
     while(itr != cend())
@@ -255,6 +270,9 @@ RTTR_INLINE bool array_range<T, Predicate>::empty() const
     if (m_begin == m_end)
         return true;
 
+    if (!m_has_predicate)
+        return false;
+
     const_iterator itr{m_begin, this};
     if (m_pred(*itr))
         return false;
@@ -283,11 +301,13 @@ template<typename DataType>
 RTTR_INLINE void array_range<T, Predicate>::next(array_iterator<DataType>& itr) const
 {
     ++itr.m_ptr;
+    if (!m_has_predicate)
+        return;
+
     while(itr.m_ptr != m_end && !m_pred(*itr.m_ptr))
     {
         ++itr.m_ptr;
     }
-
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -297,6 +317,9 @@ template<typename DataType>
 RTTR_INLINE void array_range<T, Predicate>::prev(array_reverse_iterator<DataType>& itr) const
 {
     --itr.m_ptr;
+    if (!m_has_predicate)
+        return;
+
     while(itr.m_ptr != (m_begin - 1) && !m_pred(*itr.m_ptr))
     {
         --itr.m_ptr;
@@ -494,6 +517,22 @@ struct default_predicate
     std::function<bool(const T&)> m_func;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Predicate>
+RTTR_INLINE bool has_predicate(const Predicate&) RTTR_NOEXCEPT
+{
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool has_predicate(const default_predicate<T>& pred) RTTR_NOEXCEPT
+{
+    return static_cast<bool>(pred.m_func);
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
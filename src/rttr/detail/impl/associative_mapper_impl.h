@@ -32,6 +32,9 @@
 #include "rttr/detail/misc/iterator_wrapper.h"
 
 #include "rttr/variant.h"
+#include "rttr/array_range.h"
+#include "rttr/sorted_vector_map.h"
+#include "rttr/sorted_vector_set.h"
 #include <type_traits>
 
 #include <set>
@@ -228,6 +231,101 @@ associative_container_base_insert_key_value(void* container, argument& key, argu
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+RTTR_FORCE_INLINE static enable_if_t<!std::is_const<T>::value && has_reserve_func<T>::value, bool>
+associative_container_base_reserve(void* container, std::size_t size)
+{
+    reinterpret_cast<T*>(container)->reserve(size);
+    return true;
+}
+
+template<typename T>
+RTTR_FORCE_INLINE static enable_if_t<std::is_const<T>::value || !has_reserve_func<T>::value, bool>
+associative_container_base_reserve(void* container, std::size_t size)
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static bool associative_container_is_type_valid(const Argument_Range& args)
+{
+    const auto expected_type = ::rttr::type::get<T>();
+    for (const auto& arg : args)
+    {
+        if (arg.get_type() != expected_type)
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static enable_if_t<!std::is_const<T>::value && !is_key_value_container<T>::value, std::size_t>
+associative_container_base_insert_range_key(void* container, const Argument_Range& keys)
+{
+    using key_t = typename T::key_type;
+    if (!associative_container_is_type_valid<key_t>(keys))
+        return 0;
+
+    auto& self = *reinterpret_cast<T*>(container);
+    const std::size_t old_size = self.size();
+    associative_container_base_reserve<T>(container, old_size + keys.size());
+    for (const auto& key : keys)
+        self.insert(key.template get_value<key_t>());
+
+    return (self.size() - old_size);
+}
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static enable_if_t<std::is_const<T>::value || is_key_value_container<T>::value, std::size_t>
+associative_container_base_insert_range_key(void* container, const Argument_Range& keys)
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static enable_if_t<!std::is_const<T>::value && is_key_value_container<T>::value, std::size_t>
+associative_container_base_insert_range_key_value(void* container, const Argument_Range& keys, const Argument_Range& values)
+{
+    using key_t = typename T::key_type;
+    using value_t = typename T::mapped_type;
+    if (keys.size() != values.size() ||
+        !associative_container_is_type_valid<key_t>(keys) ||
+        !associative_container_is_type_valid<value_t>(values))
+    {
+        return 0;
+    }
+
+    auto& self = *reinterpret_cast<T*>(container);
+    const std::size_t old_size = self.size();
+    associative_container_base_reserve<T>(container, old_size + keys.size());
+    auto value_itr = values.begin();
+    for (const auto& key : keys)
+    {
+        self.insert(std::make_pair(key.template get_value<key_t>(), value_itr->template get_value<value_t>()));
+        ++value_itr;
+    }
+
+    return (self.size() - old_size);
+}
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static enable_if_t<std::is_const<T>::value || !is_key_value_container<T>::value, std::size_t>
+associative_container_base_insert_range_key_value(void* container, const Argument_Range& keys, const Argument_Range& values)
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
 template<typename T, typename ConstType, typename Tp = conditional_t<std::is_const<ConstType>::value,
                                                                      typename T::const_iterator,
                                                                      typename T::iterator>>
@@ -298,6 +396,22 @@ struct associative_container_base : iterator_wrapper_associative_container<Tp>
         associative_container_mapper<T, ConstType>::create(itr, ret.first);
         return ret.second;
     }
+
+    static bool reserve(void* container, std::size_t size)
+    {
+        return associative_container_base_reserve<ConstType>(container, size);
+    }
+
+    static std::size_t insert_range_key(void* container, const array_range<argument>& keys)
+    {
+        return associative_container_base_insert_range_key<ConstType>(container, keys);
+    }
+
+    static std::size_t insert_range_key_value(void* container, const array_range<argument>& keys,
+                                              const array_range<argument>& values)
+    {
+        return associative_container_base_insert_range_key_value<ConstType>(container, keys, values);
+    }
 };
 
 //////////////////////////////////////////////////////////////////////////////////////
@@ -315,6 +429,118 @@ struct associative_container_key_base : associative_container_base<T, Args...>
     {
         return variant();
     }
+
+    static instance get_key_ref(const iterator_data& itr)
+    {
+        auto& it = associative_container_base<T,  Args...>::get_iterator(itr);
+        return instance(*it);
+    }
+
+    static instance get_value_ref(const iterator_data& itr)
+    {
+        return instance();
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static enable_if_t<!std::is_const<T>::value, std::size_t>
+associative_container_sorted_insert_range_key(void* container, const Argument_Range& keys)
+{
+    using key_t = typename T::key_type;
+    if (!associative_container_is_type_valid<key_t>(keys))
+        return 0;
+
+    std::vector<key_t> items;
+    items.reserve(keys.size());
+    for (const auto& key : keys)
+        items.push_back(key.template get_value<key_t>());
+
+    auto& self = *reinterpret_cast<T*>(container);
+    const std::size_t old_size = self.size();
+    self.insert(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+    return (self.size() - old_size);
+}
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static enable_if_t<std::is_const<T>::value, std::size_t>
+associative_container_sorted_insert_range_key(void* container, const Argument_Range& keys)
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static enable_if_t<!std::is_const<T>::value, std::size_t>
+associative_container_sorted_insert_range_key_value(void* container, const Argument_Range& keys, const Argument_Range& values)
+{
+    using key_t = typename T::key_type;
+    using value_t = typename T::mapped_type;
+    if (keys.size() != values.size() ||
+        !associative_container_is_type_valid<key_t>(keys) ||
+        !associative_container_is_type_valid<value_t>(values))
+    {
+        return 0;
+    }
+
+    std::vector<typename T::value_type> items;
+    items.reserve(keys.size());
+    auto value_itr = values.begin();
+    for (const auto& key : keys)
+    {
+        items.emplace_back(key.template get_value<key_t>(), value_itr->template get_value<value_t>());
+        ++value_itr;
+    }
+
+    auto& self = *reinterpret_cast<T*>(container);
+    const std::size_t old_size = self.size();
+    self.insert(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+    return (self.size() - old_size);
+}
+
+template<typename T, typename Argument_Range>
+RTTR_FORCE_INLINE static enable_if_t<std::is_const<T>::value, std::size_t>
+associative_container_sorted_insert_range_key_value(void* container, const Argument_Range& keys, const Argument_Range& values)
+{
+    return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The mapper base for \ref sorted_vector_map, the key is returned as const reference
+ * and ranges are inserted with one sort and merge step.
+ */
+template<typename T, typename ConstType>
+struct associative_container_sorted_base : associative_container_base<T, ConstType>
+{
+    static variant get_key(const iterator_data& itr)
+    {
+        auto& it = associative_container_base<T, ConstType>::get_iterator(itr);
+        return variant(std::cref(it->first));
+    }
+
+    static std::size_t insert_range_key_value(void* container, const array_range<argument>& keys,
+                                              const array_range<argument>& values)
+    {
+        return associative_container_sorted_insert_range_key_value<ConstType>(container, keys, values);
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The mapper base for \ref sorted_vector_set, ranges are inserted with one sort and merge step.
+ */
+template<typename T, typename ConstType>
+struct associative_container_sorted_key_base : associative_container_key_base<T, ConstType>
+{
+    static std::size_t insert_range_key(void* container, const array_range<argument>& keys)
+    {
+        return associative_container_sorted_insert_range_key<ConstType>(container, keys);
+    }
 };
 
 } // end namespace detail
@@ -361,6 +587,16 @@ struct associative_container_mapper<std::unordered_multimap<K, T>, Args...> : de
 
 //////////////////////////////////////////////////////////////////////////////////////
 
+template<typename K, typename C, typename...Args>
+struct associative_container_mapper<sorted_vector_set<K, C>, Args...> : detail::associative_container_sorted_key_base<sorted_vector_set<K, C>,  Args...> {};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
+template<typename K, typename T, typename C, typename...Args>
+struct associative_container_mapper<sorted_vector_map<K, T, C>, Args...> : detail::associative_container_sorted_base<sorted_vector_map<K, T, C>,  Args...> {};
+
+//////////////////////////////////////////////////////////////////////////////////////
+
 namespace detail
 {
 
@@ -393,6 +629,16 @@ struct associative_container_empty
         return variant();
     }
 
+    static instance get_key_ref(const iterator_data& itr)
+    {
+        return instance();
+    }
+
+    static instance get_value_ref(const iterator_data& itr)
+    {
+        return instance();
+    }
+
     static void begin(void* container, iterator_data& itr)
     {
 
@@ -431,6 +677,22 @@ struct associative_container_empty
     {
         return false;
     }
+
+    static bool reserve(void* container, std::size_t size)
+    {
+        return false;
+    }
+
+    static std::size_t insert_range_key(void* container, const array_range<argument>& keys)
+    {
+        return 0;
+    }
+
+    static std::size_t insert_range_key_value(void* container, const array_range<argument>& keys,
+                                              const array_range<argument>& values)
+    {
+        return 0;
+    }
 };
 
 } // end namespace detail
@@ -0,0 +1,136 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_INTERNED_STRING_IMPL_H_
+#define RTTR_INTERNED_STRING_IMPL_H_
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * One entry of the global symbol table. The characters are null-terminated.
+ */
+struct interned_string_data
+{
+    string_view m_text;
+    std::size_t m_hash;
+};
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE string_view interned_string::str() const RTTR_NOEXCEPT
+{
+    return m_data->m_text;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE interned_string::operator string_view() const RTTR_NOEXCEPT
+{
+    return m_data->m_text;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE const char* interned_string::c_str() const RTTR_NOEXCEPT
+{
+    return m_data->m_text.data();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE std::size_t interned_string::size() const RTTR_NOEXCEPT
+{
+    return m_data->m_text.size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool interned_string::empty() const RTTR_NOEXCEPT
+{
+    return m_data->m_text.empty();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE std::size_t interned_string::get_hash() const RTTR_NOEXCEPT
+{
+    return m_data->m_hash;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool interned_string::operator==(const interned_string& other) const RTTR_NOEXCEPT
+{
+    return (m_data == other.m_data);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool interned_string::operator!=(const interned_string& other) const RTTR_NOEXCEPT
+{
+    return (m_data != other.m_data);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool interned_string::operator<(const interned_string& other) const RTTR_NOEXCEPT
+{
+    return (m_data != other.m_data && m_data->m_text < other.m_data->m_text);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace std
+{
+    template<>
+    class hash<rttr::interned_string>
+    {
+    public:
+        size_t operator()(const rttr::interned_string& value) const
+        {
+            return value.get_hash();
+        }
+    };
+} // end namespace std
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // RTTR_INTERNED_STRING_IMPL_H_
@@ -0,0 +1,92 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_SORTED_VECTOR_MAP_IMPL_H_
+#define RTTR_SORTED_VECTOR_MAP_IMPL_H_
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename T, typename Compare>
+RTTR_INLINE sorted_vector_map<Key, T, Compare>::sorted_vector_map()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename T, typename Compare>
+RTTR_INLINE sorted_vector_map<Key, T, Compare>::sorted_vector_map(const Compare& comp)
+:   base_class(comp)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename T, typename Compare>
+template<typename Itr>
+RTTR_INLINE sorted_vector_map<Key, T, Compare>::sorted_vector_map(Itr first, Itr last, const Compare& comp)
+:   base_class(first, last, comp)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename T, typename Compare>
+template<typename Itr>
+RTTR_INLINE sorted_vector_map<Key, T, Compare>::sorted_vector_map(sorted_unique_t tag, Itr first, Itr last, const Compare& comp)
+:   base_class(tag, first, last, comp)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename T, typename Compare>
+RTTR_INLINE sorted_vector_map<Key, T, Compare>::sorted_vector_map(std::initializer_list<std::pair<Key, T>> list, const Compare& comp)
+:   base_class(list, comp)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename T, typename Compare>
+RTTR_INLINE T& sorted_vector_map<Key, T, Compare>::operator[](const Key& key)
+{
+    auto itr = this->lower_bound(key);
+    if (itr == this->end() || this->m_compare(key, itr->first))
+        itr = this->m_data.insert(itr, std::make_pair(key, T()));
+
+    return itr->second;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_SORTED_VECTOR_MAP_IMPL_H_
@@ -30,6 +30,9 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/variant.h"
+#include "rttr/interned_string.h"
+
+#include <string>
 
 namespace rttr
 {
@@ -39,19 +42,26 @@ namespace detail
 /*!
  * This class holds meta data.
  *
+ * Keys of string type are additionally interned during registration,
+ * so they can be found via an \ref interned_string without creating a variant.
  */
 class RTTR_API metadata
 {
     public:
         metadata() { }
-        metadata(variant key, variant value) : m_key(std::move(key)), m_value(std::move(value)) { }
-        metadata(const metadata& other) : m_key(other.m_key), m_value(other.m_value) {}
-        metadata(metadata&& other) : m_key(std::move(other.m_key)), m_value(std::move(other.m_value)) {}
-        metadata& operator=(const metadata& other) { m_key = other.m_key; m_value = other.m_value; return *this; }
+        metadata(variant key, variant value) : m_key(std::move(key)), m_value(std::move(value)), m_interned_key(create_interned_key(m_key)) { }
+        metadata(const metadata& other) : m_key(other.m_key), m_value(other.m_value), m_interned_key(other.m_interned_key) {}
+        metadata(metadata&& other) : m_key(std::move(other.m_key)), m_value(std::move(other.m_value)), m_interned_key(other.m_interned_key) {}
+        metadata& operator=(const metadata& other) { m_key = other.m_key; m_value = other.m_value; m_interned_key = other.m_interned_key; return *this; }
 
         variant get_key() const      { return m_key; }
         variant get_value() const    { return m_value; }
 
+        /*!
+         * Returns the interned key, when the key is a string, otherwise an empty interned_string.
+         */
+        const interned_string& get_interned_key() const RTTR_NOEXCEPT { return m_interned_key; }
+
         struct order_by_key
         {
             RTTR_INLINE bool operator () ( const metadata& _left, const metadata& _right )  const
@@ -69,8 +79,22 @@ class RTTR_API metadata
         };
 
     private:
-        variant m_key;
-        variant m_value;
+        static interned_string create_interned_key(const variant& key)
+        {
+            if (key.is_type<std::string>())
+                return interned_string(key.get_value<std::string>());
+            else if (key.is_type<string_view>())
+                return interned_string(key.get_value<string_view>());
+            else if (key.is_type<interned_string>())
+                return key.get_value<interned_string>();
+            else
+                return interned_string();
+        }
+
+    private:
+        variant         m_key;
+        variant         m_value;
+        interned_string m_interned_key;
 };
 
 } // end namespace detail
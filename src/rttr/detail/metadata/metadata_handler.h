@@ -59,6 +59,21 @@ class metadata_handler
             return variant();
         }
 
+        RTTR_FORCE_INLINE variant get_metadata(const interned_string& key) const
+        {
+            // non string keys have an empty interned key
+            if (key.empty())
+                return get_metadata(variant(std::string()));
+
+            for (const auto& item : m_metadata_list)
+            {
+                if (item.get_interned_key() == key)
+                    return item.get_value();
+            }
+
+            return variant();
+        }
+
     private:
         std::array<metadata, Metadata_Count> m_metadata_list;
 };
@@ -76,6 +91,8 @@ class metadata_handler<0>
         RTTR_FORCE_INLINE void set_metadata(std::array<metadata, 0> new_data) { }
 
         RTTR_FORCE_INLINE variant get_metadata(const variant& key) const  { return variant(); }
+
+        RTTR_FORCE_INLINE variant get_metadata(const interned_string& key) const  { return variant(); }
 };
 
 } // end namespace detail
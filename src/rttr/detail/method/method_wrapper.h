@@ -84,6 +84,9 @@ class method_wrapper<F, Acc_Level, Policy, default_args<>, parameter_infos<Param
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>(const_cast<decltype(m_param_info_list)&>(m_param_info_list).data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke(instance& object) const
         {
@@ -162,6 +165,9 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>(const_cast<decltype(m_param_info_list)&>(m_param_info_list).data(),
                                                                                                        m_param_info_list.size()); }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke(instance& object) const
         {
@@ -233,6 +239,9 @@ class method_wrapper<F, Acc_Level, Policy, default_args<>, parameter_infos<>, Me
         access_levels get_access_level()                    const RTTR_NOEXCEPT { return Acc_Level;                                       }
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>();                   }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke(instance& object) const
         {
@@ -305,6 +314,9 @@ class method_wrapper<F, Acc_Level, Policy, default_args<Default_Args...>, parame
         access_levels get_access_level()                    const RTTR_NOEXCEPT { return Acc_Level;                                       }
         array_range<parameter_info> get_parameter_infos()   const RTTR_NOEXCEPT { return array_range<parameter_info>();                   }
         variant get_metadata(const variant& key)            const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        variant get_metadata(const interned_string& key)    const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count()    const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()            const RTTR_NOEXCEPT { return sizeof(*this); }
 
         variant invoke(instance& object) const
         {
@@ -28,6 +28,7 @@
 #include "rttr/detail/method/method_wrapper_base.h"
 #include "rttr/argument.h"
 #include "rttr/instance.h"
+#include "rttr/detail/misc/utility.h"
 
 using namespace std;
 
@@ -170,6 +171,34 @@ variant method_wrapper_base::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant method_wrapper_base::get_metadata(const interned_string& key) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t method_wrapper_base::get_metadata_count() const RTTR_NOEXCEPT
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t method_wrapper_base::get_sizeof() const RTTR_NOEXCEPT
+{
+    return sizeof(*this);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t method_wrapper_base::get_allocated_size() const RTTR_NOEXCEPT
+{
+    return detail::get_allocated_size(m_signature);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 
 variant method_wrapper_base::invoke(instance& object) const
 {
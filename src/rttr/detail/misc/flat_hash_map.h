@@ -0,0 +1,463 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_FLAT_HASH_MAP_H_
+#define RTTR_FLAT_HASH_MAP_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <vector>
+#include <utility>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define RTTR_FLAT_HASH_MAP_USE_SSE2 1
+#   include <emmintrin.h>
+#endif
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A group of 16 control bytes of a \ref flat_hash_table.
+ *
+ * Every control byte describes one slot: it is either `empty`, `deleted`
+ * or contains the lower 7 bits of the hash value of the stored key (always a positive value).
+ * With SSE2 a whole group is matched with one compare instruction.
+ */
+class hash_ctrl_group
+{
+    public:
+        static RTTR_CONSTEXPR_OR_CONST std::size_t width = 16;
+        static RTTR_CONSTEXPR_OR_CONST int8_t empty     = -128;
+        static RTTR_CONSTEXPR_OR_CONST int8_t deleted   = -2;
+
+        explicit hash_ctrl_group(const int8_t* ctrl) RTTR_NOEXCEPT
+        :   m_ctrl(ctrl)
+        {
+        }
+
+        /*!
+         * Returns a bit mask of all slots, which contains the given \p h2 value.
+         */
+        RTTR_INLINE uint32_t match(int8_t h2) const RTTR_NOEXCEPT
+        {
+#if RTTR_FLAT_HASH_MAP_USE_SSE2
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), load())));
+#else
+            uint32_t mask = 0;
+            for (std::size_t i = 0; i < width; ++i)
+                mask |= static_cast<uint32_t>(m_ctrl[i] == h2) << i;
+            return mask;
+#endif
+        }
+
+        /*!
+         * Returns a bit mask of all empty slots.
+         */
+        RTTR_INLINE uint32_t match_empty() const RTTR_NOEXCEPT
+        {
+            return match(empty);
+        }
+
+        /*!
+         * Returns a bit mask of all slots, which are empty or deleted.
+         */
+        RTTR_INLINE uint32_t match_empty_or_deleted() const RTTR_NOEXCEPT
+        {
+#if RTTR_FLAT_HASH_MAP_USE_SSE2
+            return static_cast<uint32_t>(_mm_movemask_epi8(load()));
+#else
+            uint32_t mask = 0;
+            for (std::size_t i = 0; i < width; ++i)
+                mask |= static_cast<uint32_t>(m_ctrl[i] < 0) << i;
+            return mask;
+#endif
+        }
+
+        /*!
+         * Returns the index of the lowest set bit in \p mask; \p mask must not be zero.
+         */
+        static RTTR_INLINE std::size_t get_lowest_bit_index(uint32_t mask) RTTR_NOEXCEPT
+        {
+#if RTTR_COMPILER == RTTR_COMPILER_GNUC || RTTR_COMPILER == RTTR_COMPILER_CLANG
+            return static_cast<std::size_t>(__builtin_ctz(mask));
+#else
+            std::size_t index = 0;
+            while ((mask & 1u) == 0)
+            {
+                mask >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+    private:
+#if RTTR_FLAT_HASH_MAP_USE_SSE2
+        RTTR_INLINE __m128i load() const RTTR_NOEXCEPT
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(m_ctrl));
+        }
+#endif
+
+    private:
+        const int8_t* m_ctrl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief The \ref flat_hash_table class implements an open addressing hash table,
+ *        the slots are probed group wise via the control bytes in \ref hash_ctrl_group.
+ *
+ * The keys and values are stored densely in insertion order, the slots contain only the index into these lists.
+ * So \ref value_data() can still be returned as one contiguous list.
+ *
+ * When \p Multiple_Keys is `true`, the same key can be inserted several times;
+ * all values of the same key are linked together and can be visited with \ref find_next().
+ */
+template<typename Key, typename Value, template<class> class Hash, bool Multiple_Keys>
+class flat_hash_table
+{
+    struct key_data
+    {
+        Key         m_key;
+        std::size_t m_hash_value;
+        uint32_t    m_next;     // index of the next value with the same key
+        bool        m_is_head;  // true, when this entry is referenced from a slot
+    };
+
+    public:
+        using value_type = std::pair<const Key, Value>;
+        using iterator = typename std::vector<Value>::iterator;
+        using const_iterator = typename std::vector<Value>::const_iterator;
+        using hash_type = std::size_t;
+
+        flat_hash_table() : m_group_mask(0), m_growth_left(0) {}
+
+    private:
+        using has_type = Hash<Key>;
+        static RTTR_CONSTEXPR_OR_CONST uint32_t npos = static_cast<uint32_t>(-1);
+        static RTTR_CONSTEXPR_OR_CONST std::size_t invalid_slot = static_cast<std::size_t>(-1);
+
+    public:
+        iterator end()
+        {
+            return m_value_list.end();
+        }
+
+        const_iterator end() const
+        {
+            return m_value_list.end();
+        }
+
+        const_iterator cend() const
+        {
+            return m_value_list.cend();
+        }
+
+        void insert(value_type&& value)
+        {
+            insert(Key(value.first), std::move(value.second));
+        }
+
+        void insert(Key key, Value value)
+        {
+            const auto hash_value = has_type()(key);
+            const auto index = static_cast<uint32_t>(m_value_list.size());
+            const auto slot = find_slot(key, hash_value);
+            if (slot != invalid_slot)
+            {
+                if (!Multiple_Keys)
+                    return;
+
+                // append the value at the end of the list of values with the same key
+                auto item = &m_key_list[m_slots[slot]];
+                while (item->m_next != npos)
+                    item = &m_key_list[item->m_next];
+
+                item->m_next = index;
+                m_key_list.push_back(key_data{std::move(key), hash_value, npos, false});
+                m_value_list.push_back(std::move(value));
+                return;
+            }
+
+            if (m_growth_left == 0)
+                rehash(m_slots.empty() ? std::size_t(hash_ctrl_group::width) : m_slots.size() * 2);
+
+            m_key_list.push_back(key_data{std::move(key), hash_value, npos, true});
+            m_value_list.push_back(std::move(value));
+            insert_slot(hash_value, index);
+        }
+
+        template<typename T>
+        const_iterator find(const T& key) const
+        {
+            return find(key, Hash<T>()(key));
+        }
+
+        /*!
+         * Finds the \p key with an already calculated \p hash_value, which must be created with the same hash algorithm.
+         */
+        template<typename T>
+        const_iterator find(const T& key, hash_type hash_value) const
+        {
+            const auto slot = find_slot(key, hash_value);
+            if (slot != invalid_slot)
+                return (m_value_list.cbegin() + m_slots[slot]);
+            else
+                return m_value_list.cend();
+        }
+
+        /*!
+         * Returns the next value with the same key as \p itr, or \ref end() when there is no one.
+         */
+        const_iterator find_next(const_iterator itr) const
+        {
+            const auto next = m_key_list[static_cast<std::size_t>(itr - m_value_list.cbegin())].m_next;
+            if (next != npos)
+                return (m_value_list.cbegin() + next);
+            else
+                return m_value_list.cend();
+        }
+
+        /*!
+         * Removes the value with the given \p key; the last value is moved into the free place.
+         *
+         * \remark Only available when the keys are unique.
+         */
+        void erase(const Key& key)
+        {
+            static_assert(!Multiple_Keys, "erase() is not supported when multiple keys are allowed.");
+
+            const auto slot = find_slot(key, has_type()(key));
+            if (slot == invalid_slot)
+                return;
+
+            const auto index = m_slots[slot];
+            m_ctrl[slot] = hash_ctrl_group::deleted;
+
+            const auto last_index = static_cast<uint32_t>(m_value_list.size() - 1);
+            if (index != last_index)
+            {
+                m_slots[find_slot_of_index(m_key_list[last_index].m_hash_value, last_index)] = index;
+                m_key_list[index]   = std::move(m_key_list[last_index]);
+                m_value_list[index] = std::move(m_value_list[last_index]);
+            }
+
+            m_key_list.pop_back();
+            m_value_list.pop_back();
+        }
+
+        void clear()
+        {
+            m_key_list.clear();
+            m_value_list.clear();
+            m_ctrl.clear();
+            m_slots.clear();
+            m_group_mask = 0;
+            m_growth_left = 0;
+        }
+
+        std::size_t size() const
+        {
+            return m_value_list.size();
+        }
+
+        const std::vector<Value>& value_data() const
+        {
+            return m_value_list;
+        }
+
+        /*!
+         * Returns the number of bytes, which are allocated by the table itself.
+         * Heap memory owned by the keys or values is not included.
+         */
+        std::size_t get_allocated_size() const
+        {
+            return (m_key_list.capacity() * sizeof(key_data) + m_value_list.capacity() * sizeof(Value) +
+                    m_ctrl.capacity() * sizeof(int8_t) + m_slots.capacity() * sizeof(uint32_t));
+        }
+
+    private:
+        /*!
+         * The hash values of the names are not well distributed in all bits,
+         * so they are mixed before splitting them into the group index (h1) and the control byte (h2).
+         */
+        static RTTR_INLINE std::size_t mix_hash(std::size_t hash_value) RTTR_NOEXCEPT
+        {
+            const uint64_t value = static_cast<uint64_t>(hash_value) * UINT64_C(0x9E3779B97F4A7C15);
+            return static_cast<std::size_t>(value ^ (value >> 32));
+        }
+
+        static RTTR_INLINE std::size_t get_h1(std::size_t hash_value) RTTR_NOEXCEPT
+        {
+            return (mix_hash(hash_value) >> 7);
+        }
+
+        static RTTR_INLINE int8_t get_h2(std::size_t hash_value) RTTR_NOEXCEPT
+        {
+            return static_cast<int8_t>(mix_hash(hash_value) & 0x7F);
+        }
+
+        template<typename T>
+        std::size_t find_slot(const T& key, std::size_t hash_value) const
+        {
+            if (m_slots.empty())
+                return invalid_slot;
+
+            const auto h2 = get_h2(hash_value);
+            auto group_index = get_h1(hash_value) & m_group_mask;
+            for (std::size_t probe = 1; probe <= m_group_mask + 1; ++probe)
+            {
+                const auto offset = group_index * hash_ctrl_group::width;
+                const hash_ctrl_group group(&m_ctrl[offset]);
+                for (auto mask = group.match(h2); mask != 0; mask &= (mask - 1))
+                {
+                    const auto slot = offset + hash_ctrl_group::get_lowest_bit_index(mask);
+                    const auto& item = m_key_list[m_slots[slot]];
+                    if (item.m_hash_value == hash_value && item.m_key == key)
+                        return slot;
+                }
+
+                if (group.match_empty())
+                    return invalid_slot;
+
+                group_index = (group_index + probe) & m_group_mask;
+            }
+
+            return invalid_slot;
+        }
+
+        std::size_t find_slot_of_index(std::size_t hash_value, uint32_t index) const
+        {
+            const auto h2 = get_h2(hash_value);
+            auto group_index = get_h1(hash_value) & m_group_mask;
+            for (std::size_t probe = 1; probe <= m_group_mask + 1; ++probe)
+            {
+                const auto offset = group_index * hash_ctrl_group::width;
+                for (auto mask = hash_ctrl_group(&m_ctrl[offset]).match(h2); mask != 0; mask &= (mask - 1))
+                {
+                    const auto slot = offset + hash_ctrl_group::get_lowest_bit_index(mask);
+                    if (m_slots[slot] == index)
+                        return slot;
+                }
+
+                group_index = (group_index + probe) & m_group_mask;
+            }
+
+            return invalid_slot;
+        }
+
+        std::size_t find_free_slot(std::size_t hash_value) const
+        {
+            // the load factor ensures there is always a free slot,
+            // and the triangular probing visits every group, because the group count is a power of two
+            auto group_index = get_h1(hash_value) & m_group_mask;
+            for (std::size_t probe = 1; ; ++probe)
+            {
+                const auto offset = group_index * hash_ctrl_group::width;
+                const auto mask = hash_ctrl_group(&m_ctrl[offset]).match_empty_or_deleted();
+                if (mask != 0)
+                    return (offset + hash_ctrl_group::get_lowest_bit_index(mask));
+
+                group_index = (group_index + probe) & m_group_mask;
+            }
+        }
+
+        void insert_slot(std::size_t hash_value, uint32_t index)
+        {
+            const auto slot = find_free_slot(hash_value);
+            if (m_ctrl[slot] == hash_ctrl_group::empty)
+                --m_growth_left;
+
+            m_ctrl[slot] = get_h2(hash_value);
+            m_slots[slot] = index;
+        }
+
+        void rehash(std::size_t capacity)
+        {
+            m_ctrl.assign(capacity, int8_t(hash_ctrl_group::empty));
+            m_slots.assign(capacity, 0);
+            m_group_mask = capacity / hash_ctrl_group::width - 1;
+            m_growth_left = capacity - capacity / 8;
+
+            uint32_t index = 0;
+            for (const auto& item : m_key_list)
+            {
+                if (item.m_is_head)
+                    insert_slot(item.m_hash_value, index);
+
+                ++index;
+            }
+        }
+
+    private:
+        std::vector<key_data>   m_key_list;
+        std::vector<Value>      m_value_list;
+        std::vector<int8_t>     m_ctrl;
+        std::vector<uint32_t>   m_slots;
+        std::size_t             m_group_mask;
+        std::size_t             m_growth_left;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename Value, template<class> class Hash, bool Multiple_Keys>
+RTTR_CONSTEXPR_OR_CONST uint32_t flat_hash_table<Key, Value, Hash, Multiple_Keys>::npos;
+
+template<typename Key, typename Value, template<class> class Hash, bool Multiple_Keys>
+RTTR_CONSTEXPR_OR_CONST std::size_t flat_hash_table<Key, Value, Hash, Multiple_Keys>::invalid_slot;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief A hash map with unique keys.
+ */
+template<typename Key, typename Value, template<class> class Hash = std::hash>
+using flat_hash_map = flat_hash_table<Key, Value, Hash, false>;
+
+/*!
+ * \brief A hash map, where the same key can be inserted several times.
+ */
+template<typename Key, typename Value, template<class> class Hash = std::hash>
+using flat_hash_multimap = flat_hash_table<Key, Value, Hash, true>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_FLAT_HASH_MAP_H_
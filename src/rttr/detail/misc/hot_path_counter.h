@@ -0,0 +1,129 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_HOT_PATH_COUNTER_H_
+#define RTTR_HOT_PATH_COUNTER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#if RTTR_HOT_PATH_COUNTERS
+
+#include "rttr/hot_path_counters.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if RTTR_COMPILER == RTTR_COMPILER_MSVC && (defined(_M_X64) || defined(_M_IX86))
+#   include <intrin.h>
+#   define RTTR_HOT_PATH_USE_TSC 1
+#elif (RTTR_COMPILER == RTTR_COMPILER_GNUC || RTTR_COMPILER == RTTR_COMPILER_CLANG) && (defined(__x86_64__) || defined(__i386__))
+#   include <x86intrin.h>
+#   define RTTR_HOT_PATH_USE_TSC 1
+#else
+#   define RTTR_HOT_PATH_USE_TSC 0
+#endif
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The counters of one item for one thread.
+ *
+ * Every slot occupies its own cache line, so the slots of different threads never share a cache line.
+ * Only the owning thread writes the counters, therefore a relaxed load and store is sufficient.
+ */
+struct counter_slot
+{
+    std::atomic<uint64_t>   m_count;
+    std::atomic<uint64_t>   m_ticks;
+    std::uintptr_t          m_key;
+    counter_kind            m_kind;
+};
+
+/*!
+ * Returns the counter slot of the calling thread for the item with the given \p kind and \p key.
+ * The key is the address of the wrapper object, for conversions the combined ids of source and target type.
+ */
+RTTR_LOCAL counter_slot& get_counter_slot(counter_kind kind, std::uintptr_t key);
+
+/*!
+ * Returns the current value of the time stamp counter (CPU cycles), when available;
+ * otherwise the time of a steady clock in nanoseconds.
+ */
+static RTTR_FORCE_INLINE uint64_t get_counter_ticks() RTTR_NOEXCEPT
+{
+#if RTTR_HOT_PATH_USE_TSC
+    return static_cast<uint64_t>(__rdtsc());
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/*!
+ * Counts the call of a hot path function and measures its wall time, until the scope is left.
+ */
+class hot_path_counter_scope
+{
+    public:
+        RTTR_FORCE_INLINE hot_path_counter_scope(counter_kind kind, std::uintptr_t key)
+        :   m_slot(get_counter_slot(kind, key)),
+            m_start(get_counter_ticks())
+        {
+        }
+
+        RTTR_FORCE_INLINE ~hot_path_counter_scope()
+        {
+            const auto elapsed = get_counter_ticks() - m_start;
+            m_slot.m_count.store(m_slot.m_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            m_slot.m_ticks.store(m_slot.m_ticks.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+        }
+
+    private:
+        hot_path_counter_scope(const hot_path_counter_scope&);
+        hot_path_counter_scope& operator=(const hot_path_counter_scope&);
+
+    private:
+        counter_slot&   m_slot;
+        const uint64_t  m_start;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#define RTTR_COUNT_HOT_PATH(kind, key) const ::rttr::detail::hot_path_counter_scope rttr_hot_path_counter_scope(kind, key)
+
+#else
+
+#define RTTR_COUNT_HOT_PATH(kind, key)
+
+#endif // RTTR_HOT_PATH_COUNTERS
+
+#endif // RTTR_HOT_PATH_COUNTER_H_
@@ -31,6 +31,7 @@
 #include "rttr/detail/base/core_prerequisites.h"
 
 #include "rttr/variant.h"
+#include "rttr/instance.h"
 
 #include <memory>
 #include <type_traits>
@@ -156,6 +157,18 @@ struct iterator_wrapper_associative_container : iterator_wrapper_base<Itr>
         auto& it = iterator_wrapper_base<Itr>::get_iterator(itr);
         return variant(std::ref(it->second));
     }
+
+    static instance get_key_ref(const iterator_data& itr)
+    {
+        auto& it = iterator_wrapper_base<Itr>::get_iterator(itr);
+        return instance(it->first);
+    }
+
+    static instance get_value_ref(const iterator_data& itr)
+    {
+        auto& it = iterator_wrapper_base<Itr>::get_iterator(itr);
+        return instance(it->second);
+    }
 };
 
 } // end namespace detail
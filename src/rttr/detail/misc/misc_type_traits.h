@@ -38,6 +38,7 @@
 
 #include <type_traits>
 #include <memory>
+#include <iterator>
 
 namespace rttr
 {
@@ -711,6 +712,28 @@ namespace detail
     struct has_equal_operator : std::integral_constant<bool, std::is_same<std::true_type,
                                                                           decltype(supports_equal_test(std::declval<T>()))>::value> {};
 
+    /////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////
+    // checks whether the given type T can be iterated via 'std::begin()' and 'std::end()'
+    template<typename T, typename = decltype(std::begin(std::declval<T&>()) != std::end(std::declval<T&>()))>
+    std::true_type  supports_begin_end_test(T*);
+    std::false_type supports_begin_end_test(...);
+
+    template<typename T>
+    struct has_begin_end : std::integral_constant<bool, std::is_same<std::true_type,
+                                                                     decltype(supports_begin_end_test(std::declval<T*>()))>::value> {};
+
+    /////////////////////////////////////////////////////////////////////////////////////
+    // checks whether the given container type T has a member function 'reserve(std::size_t)'
+    template<typename T, typename = decltype(std::declval<T&>().reserve(std::size_t(0)))>
+    std::true_type  supports_reserve_test(T*);
+    std::false_type supports_reserve_test(...);
+
+    template<typename T>
+    struct has_reserve_func : std::integral_constant<bool, std::is_same<std::true_type,
+                                                                        decltype(supports_reserve_test(std::declval<T*>()))>::value> {};
+
     /////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////
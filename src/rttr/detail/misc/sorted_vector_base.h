@@ -0,0 +1,285 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_SORTED_VECTOR_BASE_H_
+#define RTTR_SORTED_VECTOR_BASE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/std_type_traits.h"
+
+#include <vector>
+#include <utility>
+#include <functional>
+#include <algorithm>
+#include <initializer_list>
+
+namespace rttr
+{
+
+/*!
+ * Tag type to indicate that the elements of a range, which is inserted into a \ref sorted_vector_map
+ * or \ref sorted_vector_set, are already sorted and do not contain duplicate keys.
+ */
+struct sorted_unique_t { };
+
+/*!
+ * Tag object of type \ref sorted_unique_t.
+ */
+RTTR_CONSTEXPR_OR_CONST sorted_unique_t sorted_unique = sorted_unique_t();
+
+namespace detail
+{
+
+/*!
+ * Implements the common part of \ref sorted_vector_map and \ref sorted_vector_set.
+ *
+ * The elements are stored in one `std::vector`, ordered by their key, without duplicates.
+ * The function object \p Key_Of_Value extracts the key from a stored element.
+ */
+template<typename Key, typename Value, typename Key_Of_Value, typename Compare, bool Is_Const_Iterator>
+class sorted_vector_base
+{
+    public:
+        using key_type          = Key;
+        using value_type        = Value;
+        using key_compare       = Compare;
+        using size_type         = std::size_t;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = value_type&;
+        using const_reference   = const value_type&;
+        using const_iterator    = typename std::vector<Value>::const_iterator;
+        using iterator          = conditional_t<Is_Const_Iterator, const_iterator, typename std::vector<Value>::iterator>;
+
+        sorted_vector_base() {}
+
+        explicit sorted_vector_base(const Compare& comp) : m_compare(comp) {}
+
+        template<typename Itr>
+        sorted_vector_base(Itr first, Itr last, const Compare& comp = Compare())
+        :   m_compare(comp)
+        {
+            insert(first, last);
+        }
+
+        template<typename Itr>
+        sorted_vector_base(sorted_unique_t, Itr first, Itr last, const Compare& comp = Compare())
+        :   m_data(first, last),
+            m_compare(comp)
+        {
+        }
+
+        sorted_vector_base(std::initializer_list<value_type> list, const Compare& comp = Compare())
+        :   m_compare(comp)
+        {
+            insert(list.begin(), list.end());
+        }
+
+        iterator begin()                            { return m_data.begin(); }
+        const_iterator begin() const                { return m_data.begin(); }
+        const_iterator cbegin() const               { return m_data.cbegin(); }
+        iterator end()                              { return m_data.end(); }
+        const_iterator end() const                  { return m_data.end(); }
+        const_iterator cend() const                 { return m_data.cend(); }
+
+        bool empty() const RTTR_NOEXCEPT            { return m_data.empty(); }
+        size_type size() const RTTR_NOEXCEPT        { return m_data.size(); }
+        size_type capacity() const RTTR_NOEXCEPT    { return m_data.capacity(); }
+        void reserve(size_type new_capacity)        { m_data.reserve(new_capacity); }
+        void clear() RTTR_NOEXCEPT                  { m_data.clear(); }
+        key_compare key_comp() const                { return m_compare; }
+
+        const value_type* data() const RTTR_NOEXCEPT { return m_data.data(); }
+        const std::vector<Value>& values() const RTTR_NOEXCEPT { return m_data; }
+
+        std::pair<iterator, bool> insert(const value_type& value)
+        {
+            auto itr = lower_bound_impl(Key_Of_Value::get(value));
+            if (itr != m_data.end() && !m_compare(Key_Of_Value::get(value), Key_Of_Value::get(*itr)))
+                return std::make_pair(to_iterator(itr), false);
+
+            return std::make_pair(to_iterator(m_data.insert(to_iterator(itr), value)), true);
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value)
+        {
+            auto itr = lower_bound_impl(Key_Of_Value::get(value));
+            if (itr != m_data.end() && !m_compare(Key_Of_Value::get(value), Key_Of_Value::get(*itr)))
+                return std::make_pair(to_iterator(itr), false);
+
+            return std::make_pair(to_iterator(m_data.insert(to_iterator(itr), std::move(value))), true);
+        }
+
+        template<typename Itr>
+        void insert(Itr first, Itr last)
+        {
+            const auto old_size = m_data.size();
+            m_data.insert(m_data.end(), first, last);
+            std::stable_sort(m_data.begin() + old_size, m_data.end(), value_compare(m_compare));
+            merge_unique(old_size);
+        }
+
+        template<typename Itr>
+        void insert(sorted_unique_t, Itr first, Itr last)
+        {
+            const auto old_size = m_data.size();
+            m_data.insert(m_data.end(), first, last);
+            merge_unique(old_size);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            return to_iterator(m_data.erase(to_iterator(pos)));
+        }
+
+        size_type erase(const key_type& key)
+        {
+            const auto range = equal_range_impl(key);
+            const auto count = static_cast<size_type>(std::distance(range.first, range.second));
+            m_data.erase(to_iterator(range.first), to_iterator(range.second));
+            return count;
+        }
+
+        iterator find(const key_type& key)                  { return to_iterator(find_impl(key)); }
+        const_iterator find(const key_type& key) const      { return find_impl(key); }
+        size_type count(const key_type& key) const          { return (find_impl(key) != m_data.end() ? 1 : 0); }
+        iterator lower_bound(const key_type& key)           { return to_iterator(lower_bound_impl(key)); }
+        const_iterator lower_bound(const key_type& key) const { return lower_bound_impl(key); }
+        iterator upper_bound(const key_type& key)           { return to_iterator(upper_bound_impl(key)); }
+        const_iterator upper_bound(const key_type& key) const { return upper_bound_impl(key); }
+
+        std::pair<iterator, iterator> equal_range(const key_type& key)
+        {
+            const auto range = equal_range_impl(key);
+            return std::make_pair(to_iterator(range.first), to_iterator(range.second));
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        {
+            return equal_range_impl(key);
+        }
+
+        // heterogeneous lookup, only available when the comparison function object is transparent
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        const_iterator find(const K& key) const { return find_impl(key); }
+
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        size_type count(const K& key) const { return (find_impl(key) != m_data.end() ? 1 : 0); }
+
+        template<typename K, typename C = Compare, typename = typename C::is_transparent>
+        std::pair<const_iterator, const_iterator> equal_range(const K& key) const { return equal_range_impl(key); }
+
+        void swap(sorted_vector_base& other)
+        {
+            using std::swap;
+            m_data.swap(other.m_data);
+            swap(m_compare, other.m_compare);
+        }
+
+        bool operator==(const sorted_vector_base& other) const { return (m_data == other.m_data); }
+        bool operator!=(const sorted_vector_base& other) const { return (m_data != other.m_data); }
+
+    protected:
+        struct value_compare
+        {
+            value_compare(const Compare& comp) : m_compare(comp) {}
+
+            bool operator()(const value_type& lhs, const value_type& rhs) const
+            {
+                return m_compare(Key_Of_Value::get(lhs), Key_Of_Value::get(rhs));
+            }
+
+            template<typename K>
+            bool operator()(const value_type& lhs, const K& rhs) const
+            {
+                return m_compare(Key_Of_Value::get(lhs), rhs);
+            }
+
+            template<typename K>
+            bool operator()(const K& lhs, const value_type& rhs) const
+            {
+                return m_compare(lhs, Key_Of_Value::get(rhs));
+            }
+
+            Compare m_compare;
+        };
+
+        template<typename K>
+        const_iterator lower_bound_impl(const K& key) const
+        {
+            return std::lower_bound(m_data.begin(), m_data.end(), key, value_compare(m_compare));
+        }
+
+        template<typename K>
+        const_iterator upper_bound_impl(const K& key) const
+        {
+            return std::upper_bound(m_data.begin(), m_data.end(), key, value_compare(m_compare));
+        }
+
+        template<typename K>
+        std::pair<const_iterator, const_iterator> equal_range_impl(const K& key) const
+        {
+            return std::equal_range(m_data.begin(), m_data.end(), key, value_compare(m_compare));
+        }
+
+        template<typename K>
+        const_iterator find_impl(const K& key) const
+        {
+            auto itr = lower_bound_impl(key);
+            if (itr != m_data.end() && !m_compare(key, Key_Of_Value::get(*itr)))
+                return itr;
+            else
+                return m_data.end();
+        }
+
+        typename std::vector<Value>::iterator to_iterator(const_iterator itr)
+        {
+            return m_data.begin() + std::distance(m_data.cbegin(), itr);
+        }
+
+        /*!
+         * Merges the sorted elements starting at \p old_size with the already existing elements.
+         * For equal keys, the element which was inserted first will be kept.
+         */
+        void merge_unique(size_type old_size)
+        {
+            const value_compare comp(m_compare);
+            std::inplace_merge(m_data.begin(), m_data.begin() + old_size, m_data.end(), comp);
+            auto new_end = std::unique(m_data.begin(), m_data.end(), [&comp](const value_type& lhs, const value_type& rhs)
+                                                                     { return !comp(lhs, rhs) && !comp(rhs, lhs); });
+            m_data.erase(new_end, m_data.end());
+        }
+
+    protected:
+        std::vector<Value>  m_data;
+        Compare             m_compare;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_SORTED_VECTOR_BASE_H_
@@ -39,6 +39,7 @@
 #include <utility>
 #include <algorithm>
 #include <string>
+#include <functional>
 
 namespace rttr
 {
@@ -505,6 +506,48 @@ RTTR_INLINE static std::size_t generate_hash(const char* text, std::size_t lengt
     return hash;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Generates at compile time the same hash value as \ref generate_hash().
+ */
+RTTR_CONSTEXPR static std::size_t generate_hash_constexpr(const char* text, std::size_t length,
+                                                          std::size_t hash = static_cast<std::size_t>(0xcbf29ce4))
+{
+    return (length == 0 ? hash
+                        : generate_hash_constexpr(text + 1, length - 1,
+                                                  (hash ^ static_cast<std::size_t>(*text)) * static_cast<std::size_t>(0x01000193)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Returns at compile time the length of the null terminated string \p text.
+ */
+RTTR_CONSTEXPR static std::size_t strlen_constexpr(const char* text, std::size_t length = 0)
+{
+    return (*text == '\0' ? length : strlen_constexpr(text + 1, length + 1));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * \brief Returns the number of bytes, which \p text has allocated on the heap.
+ *
+ * A short string, which is stored inside the string object itself (small string optimization),
+ * does not allocate any memory.
+ */
+RTTR_INLINE static std::size_t get_allocated_size(const std::string& text) RTTR_NOEXCEPT
+{
+    const auto object_begin = reinterpret_cast<const char*>(&text);
+    const auto object_end   = object_begin + sizeof(std::string);
+    const std::less<const char*> less;
+    if (!less(text.data(), object_begin) && less(text.data(), object_end))
+        return 0;
+
+    return (text.capacity() + 1);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // custom has functor, to make sure that "std::string" and "rttr::string_view" uses the same hashing algorithm
 template <typename T>
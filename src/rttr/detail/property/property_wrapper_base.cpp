@@ -111,6 +111,27 @@ variant property_wrapper_base::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant property_wrapper_base::get_metadata(const interned_string& key) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t property_wrapper_base::get_metadata_count() const RTTR_NOEXCEPT
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t property_wrapper_base::get_sizeof() const RTTR_NOEXCEPT
+{
+    return sizeof(*this);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool property_wrapper_base::is_array() const RTTR_NOEXCEPT
 {
     return false;
@@ -72,6 +72,9 @@ class RTTR_API property_wrapper_base
         virtual type get_type() const RTTR_NOEXCEPT;
 
         virtual variant get_metadata(const variant& key) const;
+        virtual variant get_metadata(const interned_string& key) const;
+        virtual std::size_t get_metadata_count() const RTTR_NOEXCEPT;
+        virtual std::size_t get_sizeof() const RTTR_NOEXCEPT;
 
         virtual bool is_array() const RTTR_NOEXCEPT;
 
@@ -63,6 +63,10 @@ class property_wrapper<function_ptr, Getter, Setter, Acc_Level, return_as_copy,
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             if (arg.is_type<arg_type>())
@@ -114,6 +118,10 @@ class property_wrapper<function_ptr, Getter, void, Acc_Level, return_as_copy, re
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -169,6 +177,10 @@ class property_wrapper<function_ptr, Getter, Setter, Acc_Level, return_as_ptr, s
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             using arg_type = typename std::remove_reference<arg_type>::type;
@@ -220,6 +232,10 @@ class property_wrapper<function_ptr, Getter, void, Acc_Level, return_as_ptr, rea
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -273,6 +289,10 @@ class property_wrapper<function_ptr, Getter, Setter, Acc_Level, get_as_ref_wrapp
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             using arg_type = remove_reference_t<arg_type>;
@@ -326,6 +346,10 @@ class property_wrapper<function_ptr, Getter, void, Acc_Level, get_as_ref_wrapper
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -64,6 +64,10 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, return_as_cop
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             class_type* ptr = object.try_convert<class_type>();
@@ -120,6 +124,10 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, return_as_copy,
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -177,6 +185,10 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, return_as_ptr
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             using arg_type = typename std::remove_reference<arg_type>::type;
@@ -238,6 +250,10 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, return_as_ptr,
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -295,6 +311,10 @@ class property_wrapper<member_func_ptr, Getter, Setter, Acc_Level, get_as_ref_wr
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             using arg_type = remove_reference_t<arg_type>;
@@ -356,6 +376,10 @@ class property_wrapper<member_func_ptr, Getter, void, Acc_Level, get_as_ref_wrap
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -56,6 +56,10 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             C* ptr = object.try_convert<C>();
@@ -106,6 +110,10 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_co
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -153,6 +161,10 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_pt
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             C* ptr = object.try_convert<C>();
@@ -207,6 +219,10 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, return_as_pt
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -254,6 +270,10 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, get_as_ref_w
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             C* ptr = object.try_convert<C>();
@@ -308,6 +328,10 @@ class property_wrapper<member_object_ptr, A(C::*), void, Acc_Level, get_as_ref_w
 
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
+        variant get_metadata(const interned_string& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
+        std::size_t get_metadata_count() const RTTR_NOEXCEPT { return Metadata_Count; }
+        std::size_t get_sizeof()         const RTTR_NOEXCEPT { return sizeof(*this); }
+
         bool set_value(instance& object, argument& arg) const
         {
             return false;
@@ -54,14 +54,16 @@ registration_executer::~registration_executer()
 
 void registration_executer::add_registration_func(const void* key, std::function<void(void)> func)
 {
-    auto itr = std::find_if(m_list.begin(), m_list.end(), [key](const item_type& item) { return (item.first == key); });
-    if (itr != m_list.end())
+    // the bind objects of one registration chain are destroyed in reverse order of their creation,
+    // so the key is usually found at the end of the list
+    auto itr = std::find_if(m_list.rbegin(), m_list.rend(), [key](const item_type& item) { return (item.first == key); });
+    if (itr != m_list.rend())
     {
         itr->second = std::move(func);
     }
     else
     {
-        m_list.emplace_back(std::make_pair(key, func));
+        m_list.emplace_back(key, std::move(func));
     }
 }
 
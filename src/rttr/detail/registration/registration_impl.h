@@ -92,9 +92,11 @@ RTTR_INLINE detail::parameter_names<detail::decay_t<TArgs>...> parameter_names(T
 
 template<typename Class_Type>
 registration::class_<Class_Type>::class_(string_view name)
+:   m_profile_scope(true)
 {
     auto t = type::get<Class_Type>();
     detail::type_register::custom_name(t, name);
+    m_profile_scope.set_type(t);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -291,6 +293,8 @@ namespace                                                                \
     {                                                                    \
         rttr__auto__register__()                                         \
         {                                                                \
+            const rttr::detail::registration_profile_scope               \
+                rttr_profile_scope(__FILE__, __LINE__);                  \
             rttr_auto_register_reflection_function_();                   \
         }                                                                \
     };                                                                   \
@@ -0,0 +1,91 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_REGISTRATION_PROFILE_SCOPE_H_
+#define RTTR_REGISTRATION_PROFILE_SCOPE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace rttr
+{
+class type;
+
+namespace detail
+{
+
+/*!
+ * Measures one scope of the registration for the \ref registration_profiler.
+ *
+ * When the profiler is disabled, the scope does nothing.
+ */
+class RTTR_API registration_profile_scope
+{
+    public:
+        //! Creates an inactive scope.
+        registration_profile_scope() RTTR_NOEXCEPT;
+
+        //! Starts the scope of a class registration; the name is set via \ref set_type().
+        explicit registration_profile_scope(bool is_class_scope);
+
+        //! Starts the scope of the registration block at the given source location.
+        registration_profile_scope(const char* file, int line);
+
+        ~registration_profile_scope();
+
+        //! Sets the name of a class scope.
+        void set_type(const type& t);
+
+    private:
+        registration_profile_scope(const registration_profile_scope&);
+        registration_profile_scope& operator=(const registration_profile_scope&);
+
+        void start(bool is_block, std::string name);
+
+    private:
+        std::size_t m_index;
+        uint64_t    m_start_time;
+};
+
+/*!
+ * Notifies the profiler about a type, which was registered for the first time.
+ */
+RTTR_LOCAL void profile_registered_type() RTTR_NOEXCEPT;
+
+/*!
+ * Notifies the profiler about a registered item and the bytes, which were allocated for it.
+ */
+RTTR_LOCAL void profile_registered_item(std::size_t allocated_bytes) RTTR_NOEXCEPT;
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_REGISTRATION_PROFILE_SCOPE_H_
@@ -36,11 +36,14 @@
 #include "rttr/detail/type/type_register.h"
 #include "rttr/detail/type/type_name.h"
 #include "rttr/detail/misc/utility.h"
+#include "rttr/detail/conversion/conversion_kind.h"
 #include "rttr/destructor.h"
 #include "rttr/method.h"
 #include "rttr/property.h"
 #include "rttr/constructor.h"
 #include "rttr/destructor.h"
+#include "rttr/detail/filter/filtered_item_list.h"
+#include "rttr/interned_string.h"
 
 #include <type_traits>
 #include <bitset>
@@ -77,6 +80,14 @@ struct class_data
     std::vector<method>         m_methods;
     std::vector<constructor>    m_ctors;
     destructor                  m_dtor;
+
+    // the names of all items in 'm_properties' and 'm_methods', in the same order
+    std::vector<symbol>             m_property_names;
+    std::vector<symbol>             m_method_names;
+
+    filtered_item_list<property>    m_filtered_properties;
+    filtered_item_list<method>      m_filtered_methods;
+    filtered_item_list<constructor> m_filtered_ctors;
 };
 
 enum class type_trait_infos : std::size_t
@@ -127,6 +138,7 @@ struct type_data
     class_data& (*get_class_data)();
 
     uint16_t type_index;
+    conversion_kind conv_kind;
     static const uint16_t m_invalid_id = 0;
     RTTR_FORCE_INLINE bool is_valid() const RTTR_NOEXCEPT { return (type_index != m_invalid_id); }
     RTTR_FORCE_INLINE bool type_trait_value(type_trait_infos type_trait) const RTTR_NOEXCEPT { return m_type_traits.test(static_cast<std::size_t>(type_trait)); }
@@ -238,7 +250,7 @@ type_data& get_type_data() RTTR_NOEXCEPT
     static auto instance = type_data{ raw_type_info<T>::get_type().m_type_data, wrapper_type_info<T>::get_type().m_type_data,
                                       array_raw_type<T>::get_type().m_type_data,
 
-                                      ::rttr::detail::get_type_name<T>().to_string(), ::rttr::detail::get_type_name<T>(),
+                                      std::string(), ::rttr::detail::get_type_name<T>(),
 
                                       get_size_of<T>::value(),
                                       pointer_count<T>::value,
@@ -247,6 +259,7 @@ type_data& get_type_data() RTTR_NOEXCEPT
                                       &base_classes<T>::get_types,
                                       &get_type_class_data<T>,
                                       0,
+                                      conversion_kind_of<T>::value,
                                       type_trait_value{ TYPE_TRAIT_TO_BITSET_VALUE(is_class) |
                                                         TYPE_TRAIT_TO_BITSET_VALUE(is_enum) |
                                                         TYPE_TRAIT_TO_BITSET_VALUE_2(::rttr::detail::is_array, is_array) |
@@ -272,6 +285,7 @@ static type_data& get_invalid_type_data_impl() RTTR_NOEXCEPT
                                       &base_classes<void>::get_types,
                                       &get_invalid_type_class_data,
                                       0,
+                                      conversion_kind::NONE,
                                       type_trait_value{0}};
 
     instance.raw_type_data  = &instance;
@@ -452,6 +452,14 @@ void type::register_less_than_comparator()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<std::size_t N>
+RTTR_INLINE type type::get_by_name(const char (&name)[N]) RTTR_NOEXCEPT
+{
+    return get_by_name(hashed_name(name));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 
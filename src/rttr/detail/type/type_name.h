@@ -29,38 +29,18 @@
 #define RTTR_TYPE_NAME_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/utility.h"
 
 #include "rttr/string_view.h"
 
 /////////////////////////////////////////////////////////////////////////////////
 
-#define RTTR_REGISTRATION_FUNC_EXTRACT_VARIABLES(begin_skip, end_skip)      \
-namespace rttr                                                              \
-{                                                                           \
-namespace detail                                                            \
-{                                                                           \
-    RTTR_STATIC_CONSTEXPR std::size_t skip_size_at_begin = begin_skip;      \
-    RTTR_STATIC_CONSTEXPR std::size_t skip_size_at_end   = end_skip;        \
-}                                                                           \
-}
-
-/////////////////////////////////////////////////////////////////////////////////
-
-#if RTTR_COMPILER == RTTR_COMPILER_MSVC
-    // sizeof("const char *__cdecl rttr::detail::f<"), sizeof(">(void)")
-    RTTR_REGISTRATION_FUNC_EXTRACT_VARIABLES(36, 7)
-#elif RTTR_COMPILER == RTTR_COMPILER_GNUC
-    // sizeof("const char* rttr::detail::f() [with T = "), sizeof("]")
-    RTTR_REGISTRATION_FUNC_EXTRACT_VARIABLES(40, 1)
-#elif RTTR_COMPILER == RTTR_COMPILER_CLANG
-    // sizeof("const char* rttr::detail::f() [T = "), sizeof("]")
-    RTTR_REGISTRATION_FUNC_EXTRACT_VARIABLES(35, 1)
-#else
-#   error "This compiler does not supported extracting a function signature via preprocessor!"
+// The signature string cannot be read in a constant expression on every compiler,
+// in that case the type name is extracted at runtime from the signature string.
+#if defined(RTTR_NO_CXX11_CONSTEXPR) || (RTTR_COMPILER == RTTR_COMPILER_GNUC && RTTR_COMP_VER < 9000)
+#   define RTTR_NO_CONSTEXPR_TYPE_NAME
 #endif
 
-/////////////////////////////////////////////////////////////////////////////////
-
 namespace rttr
 {
 namespace detail
@@ -68,47 +48,162 @@ namespace detail
 
 /////////////////////////////////////////////////////////////////////////////////
 
-RTTR_INLINE static const char* extract_type_signature(const char* signature) RTTR_NOEXCEPT
+struct type_signature
 {
-//    static_assert(N > skip_size_at_begin + skip_size_at_end, "RTTR is misconfigured for your compiler.")
-    return &signature[rttr::detail::skip_size_at_begin];
-}
+    const char* data;
+    std::size_t size;
+};
 
 /////////////////////////////////////////////////////////////////////////////////
 
 template<typename T>
-RTTR_INLINE static const char* f() RTTR_NOEXCEPT
+RTTR_CONSTEXPR RTTR_INLINE type_signature f() RTTR_NOEXCEPT
 {
-    return extract_type_signature(
+    return
     #if RTTR_COMPILER == RTTR_COMPILER_MSVC
-                                                            __FUNCSIG__
+           type_signature{ __FUNCSIG__, sizeof(__FUNCSIG__) - 1 };
     #elif RTTR_COMPILER == RTTR_COMPILER_GNUC
-                                                            __PRETTY_FUNCTION__
+           type_signature{ __PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1 };
     #elif RTTR_COMPILER == RTTR_COMPILER_CLANG
-                                                            __PRETTY_FUNCTION__
+           type_signature{ __PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1 };
     #else
         #error "Don't know how the extract type signatur for this compiler! Abort! Abort!"
     #endif
-                                   );
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
-RTTR_INLINE static std::size_t get_size(const char* s) RTTR_NOEXCEPT
+RTTR_CONSTEXPR RTTR_INLINE std::size_t get_common_prefix_size(const char* lhs, const char* rhs, std::size_t index = 0) RTTR_NOEXCEPT
+{
+    return ((lhs[index] != '\0' && lhs[index] == rhs[index]) ? get_common_prefix_size(lhs, rhs, index + 1) : index);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The number of characters in front of the type name inside the signature of \ref f().
+ *
+ * Instead of hard coding this value for every compiler, it is measured with the signatures of two known types.
+ */
+RTTR_CONSTEXPR RTTR_INLINE std::size_t skip_size_at_begin() RTTR_NOEXCEPT
+{
+    return get_common_prefix_size(f<int>().data, f<double>().data);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The number of characters behind the type name inside the signature of \ref f().
+ */
+RTTR_CONSTEXPR RTTR_INLINE std::size_t skip_size_at_end() RTTR_NOEXCEPT
+{
+    return (f<int>().size - skip_size_at_begin() - (sizeof("int") - 1));
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_CONSTEXPR RTTR_INLINE std::size_t get_type_name_size() RTTR_NOEXCEPT
+{
+    return (f<T>().size - skip_size_at_begin() - skip_size_at_end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+#ifndef RTTR_NO_CONSTEXPR_TYPE_NAME
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+struct type_name_buffer
+{
+    char data[N + 1];
+};
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename Seq_1, typename Seq_2>
+struct concat_name_index_sequence;
+
+template<std::size_t... I1, std::size_t... I2>
+struct concat_name_index_sequence<index_sequence<I1...>, index_sequence<I2...>>
+{
+    using type = index_sequence<I1..., (sizeof...(I1) + I2)...>;
+};
+
+/*!
+ * Generates the index_sequence<0, ..., N - 1> with a logarithmic instantiation depth,
+ * so also very long type names does not exceed the template instantiation limit of the compiler.
+ */
+template<std::size_t N>
+struct make_name_index_sequence
+{
+    using type = typename concat_name_index_sequence<typename make_name_index_sequence<N / 2>::type,
+                                                     typename make_name_index_sequence<N - N / 2>::type>::type;
+};
+
+template<>
+struct make_name_index_sequence<0> { using type = index_sequence<>; };
+
+template<>
+struct make_name_index_sequence<1> { using type = index_sequence<0>; };
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t... I>
+RTTR_CONSTEXPR RTTR_INLINE type_name_buffer<sizeof...(I)> create_type_name_buffer(const char* name, index_sequence<I...>) RTTR_NOEXCEPT
+{
+    return type_name_buffer<sizeof...(I)>{ { name[I]..., '\0' } };
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Holds the trimmed type name of \p T, the copy is done at compile time.
+ *
+ * Because \ref f() is only evaluated in constant expressions,
+ * the complete signature string does not end up in the binary; only the type name itself.
+ */
+template<typename T>
+struct type_name_storage
 {
-    return ( std::char_traits<char>::length(s) - rttr::detail::skip_size_at_end);
+    RTTR_STATIC_CONSTEXPR std::size_t size = get_type_name_size<T>();
+    RTTR_STATIC_CONSTEXPR type_name_buffer<size> value = create_type_name_buffer(f<T>().data + skip_size_at_begin(),
+                                                                                 typename make_name_index_sequence<size>::type());
+};
+
+template<typename T>
+RTTR_CONSTEXPR_OR_CONST std::size_t type_name_storage<T>::size;
+
+template<typename T>
+RTTR_CONSTEXPR_OR_CONST type_name_buffer<type_name_storage<T>::size> type_name_storage<T>::value;
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE string_view get_type_name() RTTR_NOEXCEPT
+{
+    return string_view(type_name_storage<T>::value.data, type_name_storage<T>::size);
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
+#else
+
+/////////////////////////////////////////////////////////////////////////////////
+
 template<typename T>
-RTTR_INLINE static string_view get_type_name() RTTR_NOEXCEPT
+RTTR_INLINE string_view get_type_name() RTTR_NOEXCEPT
 {
-    return string_view(f<T>(), get_size(f<T>()));
+    return string_view(f<T>().data + skip_size_at_begin(), get_type_name_size<T>());
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
+#endif // RTTR_NO_CONSTEXPR_TYPE_NAME
+
+/////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
 
@@ -44,6 +44,7 @@
 
 #include "rttr/detail/filter/filter_item_funcs.h"
 #include "rttr/detail/type/type_string_utils.h"
+#include "rttr/detail/registration/registration_profile_scope.h"
 
 #include <set>
 
@@ -60,6 +61,36 @@ static std::vector<type> convert_param_list(const array_range<parameter_info>& p
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+static void update_item_indices(class_data& data, const type& t, std::vector<::rttr::property> class_data::*)
+{
+    data.m_property_names.clear();
+    data.m_property_names.reserve(data.m_properties.size());
+    for (const auto& prop : data.m_properties)
+        data.m_property_names.emplace_back(prop.get_name());
+
+    data.m_filtered_properties.update(data.m_properties, [&t](const ::rttr::property& item, filter_items filter)
+    {
+        return (is_valid_filter_item(filter) && filter_member_item(item, t, filter));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void update_item_indices(class_data& data, const type& t, std::vector<::rttr::method> class_data::*)
+{
+    data.m_method_names.clear();
+    data.m_method_names.reserve(data.m_methods.size());
+    for (const auto& meth : data.m_methods)
+        data.m_method_names.emplace_back(meth.get_name());
+
+    data.m_filtered_methods.update(data.m_methods, [&t](const ::rttr::method& item, filter_items filter)
+    {
+        return (is_valid_filter_item(filter) && filter_member_item(item, t, filter));
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void type_register::property(const type& t, unique_ptr<property_wrapper_base> prop)
 {
    type_register_private::property(t, move(prop));
@@ -214,17 +245,17 @@ std::vector<type>& type_register_private::get_type_storage()
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-flat_map<string_view, type>& type_register_private::get_orig_name_to_id()
+flat_hash_map<string_view, type>& type_register_private::get_orig_name_to_id()
 {
-    static flat_map<string_view, type> obj;
+    static flat_hash_map<string_view, type> obj;
     return obj;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-flat_map<std::string, type, hash>& type_register_private::get_custom_name_to_id()
+flat_hash_map<std::string, type, hash>& type_register_private::get_custom_name_to_id()
 {
-    static flat_map<std::string, type, hash> obj;
+    static flat_hash_map<std::string, type, hash> obj;
     return obj;
 }
 
@@ -363,6 +394,8 @@ type type_register_private::register_type(type_data& info) RTTR_NOEXCEPT
     // has to be done as last step
     register_base_class_info(info);
 
+    profile_registered_type();
+
     return type(type_data_container[id]);
 }
 
@@ -500,31 +533,51 @@ void type_register_private::register_custom_name(type& t, string_view custom_nam
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+static std::vector<std::unique_ptr<constructor_wrapper_base>>& get_constructor_storage()
+{
+    static std::vector<std::unique_ptr<constructor_wrapper_base>> container;
+    return container;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void type_register_private::constructor(const type& t, std::unique_ptr<constructor_wrapper_base> ctor)
 {
-    static std::vector<std::unique_ptr<constructor_wrapper_base> > constructor_list;
     if (!t.is_valid())
         return;
 
+    profile_registered_item(ctor->get_sizeof() + ctor->get_allocated_size());
+
     auto& class_data = t.m_type_data->get_class_data();
     class_data.m_ctors.emplace_back(create_item<::rttr::constructor>(ctor.get()));
-    constructor_list.push_back(std::move(ctor));
+    class_data.m_filtered_ctors.update(class_data.m_ctors, [&t](const ::rttr::constructor& item, filter_items filter)
+    {
+        return (is_valid_filter_item(filter) && filter_member_item(item, t, filter));
+    });
+    get_constructor_storage().push_back(std::move(ctor));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
-void type_register_private::destructor(const type& t, std::unique_ptr<destructor_wrapper_base> dtor)
+static std::vector<std::unique_ptr<destructor_wrapper_base>>& get_destructor_storage()
 {
-    static std::vector<std::unique_ptr<destructor_wrapper_base> > destructor_list;
+    static std::vector<std::unique_ptr<destructor_wrapper_base>> container;
+    return container;
+}
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void type_register_private::destructor(const type& t, std::unique_ptr<destructor_wrapper_base> dtor)
+{
     auto& dtor_type = t.m_type_data->get_class_data().m_dtor;
     if (!dtor_type) // when no dtor is set at the moment
     {
         auto d = create_item<::rttr::destructor>(dtor.get());
         dtor_type = d;
-        destructor_list.push_back(std::move(dtor));
+        get_destructor_storage().push_back(std::move(dtor));
+        profile_registered_item(sizeof(destructor_wrapper_base));
     }
 }
 
@@ -532,9 +585,9 @@ void type_register_private::destructor(const type& t, std::unique_ptr<destructor
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
-flat_multimap<string_view, ::rttr::property>& type_register_private::get_global_property_storage()
+flat_hash_multimap<string_view, ::rttr::property>& type_register_private::get_global_property_storage()
 {
-    static flat_multimap<string_view, ::rttr::property> props;
+    static flat_hash_multimap<string_view, ::rttr::property> props;
     return props;
 }
 
@@ -562,6 +615,7 @@ void type_register_private::property(const type& t, std::unique_ptr<property_wra
         if (get_type_property(t, name))
             return;
 
+        profile_registered_item(prop->get_sizeof());
         property_list.emplace_back(detail::create_item<::rttr::property>(prop.get()));
         get_property_storage().push_back(std::move(prop));
         update_class_list(t, &detail::class_data::m_properties);
@@ -571,6 +625,7 @@ void type_register_private::property(const type& t, std::unique_ptr<property_wra
         if (t.get_global_property(name))
             return;
 
+        profile_registered_item(prop->get_sizeof());
         auto p = detail::create_item<::rttr::property>(prop.get());
         get_global_property_storage().insert(std::move(name), std::move(p));
         get_property_storage().push_back(std::move(prop));
@@ -581,9 +636,9 @@ void type_register_private::property(const type& t, std::unique_ptr<property_wra
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 
-flat_multimap<string_view, ::rttr::method>& type_register_private::get_global_method_storage()
+flat_hash_multimap<string_view, ::rttr::method>& type_register_private::get_global_method_storage()
 {
-    static flat_multimap<string_view, ::rttr::method> meths;
+    static flat_hash_multimap<string_view, ::rttr::method> meths;
     return meths;
 }
 
@@ -608,6 +663,7 @@ void type_register_private::method(const type& t, std::unique_ptr<method_wrapper
         if (get_type_method(t, name, convert_param_list(meth->get_parameter_infos())))
             return;
 
+        profile_registered_item(meth->get_sizeof() + meth->get_allocated_size());
         auto& method_list = t.m_type_data->get_class_data().m_methods;
         method_list.emplace_back(create_item<::rttr::method>(meth.get()));
         get_method_storage().push_back(std::move(meth));
@@ -618,6 +674,7 @@ void type_register_private::method(const type& t, std::unique_ptr<method_wrapper
         if (t.get_global_method(name, convert_param_list(meth->get_parameter_infos())))
             return;
 
+        profile_registered_item(meth->get_sizeof() + meth->get_allocated_size());
         auto m = create_item<::rttr::method>(meth.get());
         get_global_method_storage().insert(std::move(name), std::move(m));
         get_method_storage().push_back(std::move(meth));
@@ -720,6 +777,8 @@ void type_register_private::update_class_list(const type& t, T item_ptr)
     all_class_items.reserve(all_class_items.size() + item_vec.size());
     all_class_items.insert(all_class_items.end(), item_vec.begin(), item_vec.end());
 
+    update_item_indices(t.m_type_data->get_class_data(), t.get_raw_type(), item_ptr);
+
     // update derived types
     for (const auto& derived_type : t.get_derived_classes())
         update_class_list<T>(derived_type, item_ptr);
@@ -772,6 +831,9 @@ std::vector<metadata>* type_register_private::get_metadata_list(const type& t)
 
 void type_register_private::register_enumeration(const type& t, std::unique_ptr<enumeration_wrapper_base> enum_item)
 {
+    if (t.is_valid())
+        profile_registered_item(enum_item->get_sizeof() + enum_item->get_allocated_size());
+
     register_item_type(t, std::move(enum_item), get_enumeration_list());
 }
 
@@ -952,6 +1014,26 @@ variant type_register_private::get_metadata(const variant& key, const std::vecto
     return variant();
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type_register_private::get_metadata(const type& t, const interned_string& key)
+{
+    if (key.empty())
+        return get_metadata(t, variant(std::string()));
+
+    auto meta_vec = get_metadata_list(t);
+    if (!meta_vec)
+        return variant();
+
+    for (const auto& item : *meta_vec)
+    {
+        if (item.get_interned_key() == key)
+            return item.get_value();
+    }
+
+    return variant();
+}
+
 /////////////////////////////////////////////////////////////////////////////////////
 
 enumeration type_register_private::get_enumeration(const type& t)
@@ -964,5 +1046,115 @@ enumeration type_register_private::get_enumeration(const type& t)
 
 /////////////////////////////////////////////////////////////////////////////////////
 
+template<typename T>
+static RTTR_INLINE std::size_t get_allocated_size(const std::vector<T>& vec)
+{
+    return (vec.capacity() * sizeof(T));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static RTTR_INLINE void add_item_usage(const T& item, std::size_t memory_usage::* category, memory_usage& usage)
+{
+    // the metadata is stored inside the wrapper object
+    const auto metadata_size = item.get_metadata_count() * sizeof(metadata);
+    usage.*category += item.get_sizeof() - metadata_size;
+    usage.metadata  += metadata_size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
+registration_statistics type_register_private::get_statistics()
+{
+    const auto& type_data_list = get_type_data_storage();
+    std::vector<memory_usage> usage_list(type_data_list.size());
+    // global items and the tables, which are shared by all types
+    memory_usage shared_usage;
+
+    auto get_usage = [&](const type& t) -> memory_usage&
+    {
+        const auto id = static_cast<std::size_t>(t.get_id());
+        return ((t.is_valid() && id < usage_list.size()) ? usage_list[id] : shared_usage);
+    };
+
+    for (const auto data : type_data_list)
+    {
+        if (!data->is_valid())
+            continue;
+
+        auto& usage = usage_list[data->type_index];
+        const auto& data_of_class = data->get_class_data();
+        usage.types         += sizeof(type_data) + sizeof(class_data) +
+                               get_allocated_size(data_of_class.m_base_types) +
+                               get_allocated_size(data_of_class.m_derived_types) +
+                               get_allocated_size(data_of_class.m_conversion_list);
+        usage.properties    += get_allocated_size(data_of_class.m_properties) +
+                               data_of_class.m_filtered_properties.get_allocated_size();
+        usage.methods       += get_allocated_size(data_of_class.m_methods) +
+                               data_of_class.m_filtered_methods.get_allocated_size();
+        usage.constructors  += get_allocated_size(data_of_class.m_ctors) +
+                               data_of_class.m_filtered_ctors.get_allocated_size();
+        // the custom name lookup table holds a copy of the name
+        usage.names         += 2 * get_allocated_size(data->name) +
+                               get_allocated_size(data_of_class.m_property_names) +
+                               get_allocated_size(data_of_class.m_method_names);
+    }
+
+    for (const auto& prop : get_property_storage())
+        add_item_usage(*prop, &memory_usage::properties, get_usage(prop->get_declaring_type()));
+
+    for (const auto& meth : get_method_storage())
+    {
+        auto& usage = get_usage(meth->get_declaring_type());
+        add_item_usage(*meth, &memory_usage::methods, usage);
+        usage.methods += meth->get_allocated_size();
+    }
+
+    for (const auto& ctor : get_constructor_storage())
+    {
+        auto& usage = get_usage(ctor->get_declaring_type());
+        add_item_usage(*ctor, &memory_usage::constructors, usage);
+        usage.constructors += ctor->get_allocated_size();
+    }
+
+    for (const auto& dtor : get_destructor_storage())
+        get_usage(dtor->get_destructed_type()).constructors += sizeof(destructor_wrapper_base);
+
+    for (const auto& item : get_enumeration_list())
+    {
+        auto& usage = get_usage(type(type_data_list[item.m_id]));
+        add_item_usage(*item.m_data, &memory_usage::enumerations, usage);
+        usage.enumerations += item.m_data->get_allocated_size();
+    }
+
+    for (const auto& item : get_metadata_type_list())
+        get_usage(type(type_data_list[item.m_id])).metadata += sizeof(std::vector<metadata>) + get_allocated_size(*item.m_data);
+
+    shared_usage.types          += get_allocated_size(type_data_list) + get_allocated_size(get_type_storage());
+    shared_usage.properties     += get_allocated_size(get_property_storage()) + get_global_property_storage().get_allocated_size();
+    shared_usage.methods        += get_allocated_size(get_method_storage()) + get_global_method_storage().get_allocated_size();
+    shared_usage.constructors   += get_allocated_size(get_constructor_storage()) + get_allocated_size(get_destructor_storage());
+    shared_usage.enumerations   += get_allocated_size(get_enumeration_list());
+    shared_usage.metadata       += get_allocated_size(get_metadata_type_list());
+    shared_usage.names          += get_orig_name_to_id().get_allocated_size() + get_custom_name_to_id().get_allocated_size();
+
+    registration_statistics result;
+    result.total = shared_usage;
+    for (std::size_t id = 1; id < usage_list.size(); ++id)
+    {
+        result.type_list.emplace_back(type(type_data_list[id]));
+        result.type_list.back().usage = usage_list[id];
+        result.total += usage_list[id];
+    }
+
+    std::stable_sort(result.type_list.begin(), result.type_list.end(), [](const type_memory_usage& left, const type_memory_usage& right)
+                                                                       { return left.usage.get_total() > right.usage.get_total(); });
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end
@@ -29,10 +29,10 @@
 #define RTTR_TYPE_REGISTER_P_H_
 
 #include "rttr/detail/base/core_prerequisites.h"
-#include "rttr/detail/misc/flat_multimap.h"
-#include "rttr/detail/misc/flat_map.h"
+#include "rttr/detail/misc/flat_hash_map.h"
 #include "rttr/enumeration.h"
 #include "rttr/variant.h"
+#include "rttr/registration_statistics.h"
 #include "rttr/detail/metadata/metadata.h"
 
 #include "rttr/string_view.h"
@@ -75,14 +75,14 @@ public:
     static void register_custom_name(type& t, string_view custom_name);
 
     /////////////////////////////////////////////////////////////////////////////////////
-    static flat_multimap<string_view, ::rttr::property>& get_global_property_storage();
-    static flat_multimap<string_view, ::rttr::method>& get_global_method_storage();
+    static flat_hash_multimap<string_view, ::rttr::property>& get_global_property_storage();
+    static flat_hash_multimap<string_view, ::rttr::method>& get_global_method_storage();
     /////////////////////////////////////////////////////////////////////////////////////
 
     static std::vector<type_data*>& get_type_data_storage();
     static std::vector<type>& get_type_storage();
-    static flat_map<string_view, type>& get_orig_name_to_id();
-    static flat_map<std::string, type, hash>& get_custom_name_to_id();
+    static flat_hash_map<string_view, type>& get_orig_name_to_id();
+    static flat_hash_map<std::string, type, hash>& get_custom_name_to_id();
 
     /////////////////////////////////////////////////////////////////////////////////////
 
@@ -100,10 +100,15 @@ public:
     static const type_comparator_base* get_equal_comparator(const type& t);
     static const type_comparator_base* get_less_than_comparator(const type& t);
     static variant get_metadata(const type& t, const variant& key);
+    static variant get_metadata(const type& t, const interned_string& key);
     static enumeration get_enumeration(const type& t);
 
     /////////////////////////////////////////////////////////////////////////////////////
 
+    static registration_statistics get_statistics();
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
 private:
 
     template<typename T, typename Data_Type = conditional_t<std::is_pointer<T>::value, T, std::unique_ptr<T>>>
@@ -0,0 +1,188 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/variant/variant_conversion_matrix.h"
+#include "rttr/variant.h"
+#include "rttr/detail/variant/variant_data_converter.h"
+
+#include <cstring>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Source, typename Target>
+static bool convert_basic_type(const void* source, variant& target)
+{
+    Target value;
+    if (!convert_from<Source>::to(*static_cast<const Source*>(source), value))
+        return false;
+
+    target = std::move(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Source>
+static bool convert_to_interned_string(const void* source, variant& target)
+{
+    std::string text;
+    if (!convert_from<Source>::to(*static_cast<const Source*>(source), text))
+        return false;
+
+    target = interned_string(text);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A placeholder enumeration with the underlying type \p T.
+ * It is used to instantiate \ref convert_from_enum for all enumerations with the same underlying type.
+ */
+template<typename T>
+struct enum_with_underlying_type
+{
+    enum class type : T {};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Underlying_Type, typename Target>
+static bool convert_enum_type(const void* source, variant& target)
+{
+    using enum_type = typename enum_with_underlying_type<Underlying_Type>::type;
+    Underlying_Type underlying_value;
+    std::memcpy(&underlying_value, source, sizeof(Underlying_Type));
+
+    Target value;
+    if (!convert_from_enum<enum_type>::to(static_cast<enum_type>(underlying_value), value))
+        return false;
+
+    target = std::move(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Target>
+static bool convert_chars(string_view text, variant& target)
+{
+    Target value;
+    if (!convert_from<string_view>::to(text, value))
+        return false;
+
+    target = std::move(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#define RTTR_BASIC_CONVERSION_ROW(convert_func, Source, string_func, interned_string_func)                                 \
+    { &convert_func<Source, bool>,      &convert_func<Source, char>,        &convert_func<Source, int8_t>,                 \
+      &convert_func<Source, int16_t>,   &convert_func<Source, int32_t>,     &convert_func<Source, int64_t>,                \
+      &convert_func<Source, uint8_t>,   &convert_func<Source, uint16_t>,    &convert_func<Source, uint32_t>,               \
+      &convert_func<Source, uint64_t>,  &convert_func<Source, float>,       &convert_func<Source, double>,                 \
+      string_func,                      interned_string_func }
+
+// the row order has to match the order of 'conversion_kind',
+// an enum cannot be converted to a string without its registered names,
+// a string_view is no target, because it cannot own the converted characters
+static const basic_conversion_func basic_conversion_matrix[conversion_source_count][conversion_target_count] =
+{
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, bool,            (&convert_basic_type<bool, std::string>),             (&convert_to_interned_string<bool>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, char,            (&convert_basic_type<char, std::string>),             (&convert_to_interned_string<char>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, int8_t,          (&convert_basic_type<int8_t, std::string>),           (&convert_to_interned_string<int8_t>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, int16_t,         (&convert_basic_type<int16_t, std::string>),          (&convert_to_interned_string<int16_t>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, int32_t,         (&convert_basic_type<int32_t, std::string>),          (&convert_to_interned_string<int32_t>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, int64_t,         (&convert_basic_type<int64_t, std::string>),          (&convert_to_interned_string<int64_t>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, uint8_t,         (&convert_basic_type<uint8_t, std::string>),          (&convert_to_interned_string<uint8_t>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, uint16_t,        (&convert_basic_type<uint16_t, std::string>),         (&convert_to_interned_string<uint16_t>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, uint32_t,        (&convert_basic_type<uint32_t, std::string>),         (&convert_to_interned_string<uint32_t>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, uint64_t,        (&convert_basic_type<uint64_t, std::string>),         (&convert_to_interned_string<uint64_t>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, float,           (&convert_basic_type<float, std::string>),            (&convert_to_interned_string<float>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, double,          (&convert_basic_type<double, std::string>),           (&convert_to_interned_string<double>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, std::string,     (&convert_basic_type<std::string, std::string>),      (&convert_basic_type<std::string, interned_string>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, interned_string, (&convert_basic_type<interned_string, std::string>),  (&convert_basic_type<interned_string, interned_string>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_basic_type, string_view,     (&convert_basic_type<string_view, std::string>),      (&convert_basic_type<string_view, interned_string>)),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  bool,            nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  char,            nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  int8_t,          nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  int16_t,         nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  int32_t,         nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  int64_t,         nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  uint8_t,         nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  uint16_t,        nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  uint32_t,        nullptr, nullptr),
+    RTTR_BASIC_CONVERSION_ROW(convert_enum_type,  uint64_t,        nullptr, nullptr)
+};
+
+#undef RTTR_BASIC_CONVERSION_ROW
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+basic_conversion_func get_basic_conversion_func(conversion_kind source, conversion_kind target) RTTR_NOEXCEPT
+{
+    const std::size_t source_index = static_cast<std::size_t>(source);
+    const std::size_t target_index = static_cast<std::size_t>(target);
+    if (source_index >= conversion_source_count || target_index >= conversion_target_count)
+        return nullptr;
+
+    return basic_conversion_matrix[source_index][target_index];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// the order has to match the order of 'conversion_kind'
+static const from_chars_func from_chars_table[conversion_target_count] =
+{
+    &convert_chars<bool>,       &convert_chars<char>,       &convert_chars<int8_t>,
+    &convert_chars<int16_t>,    &convert_chars<int32_t>,    &convert_chars<int64_t>,
+    &convert_chars<uint8_t>,    &convert_chars<uint16_t>,   &convert_chars<uint32_t>,
+    &convert_chars<uint64_t>,   &convert_chars<float>,      &convert_chars<double>,
+    &convert_chars<std::string>, &convert_chars<interned_string>
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+from_chars_func get_from_chars_func(conversion_kind target) RTTR_NOEXCEPT
+{
+    const std::size_t target_index = static_cast<std::size_t>(target);
+    if (target_index >= conversion_target_count)
+        return nullptr;
+
+    return from_chars_table[target_index];
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
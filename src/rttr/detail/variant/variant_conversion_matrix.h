@@ -0,0 +1,84 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_VARIANT_CONVERSION_MATRIX_H_
+#define RTTR_VARIANT_CONVERSION_MATRIX_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/conversion/conversion_kind.h"
+#include "rttr/string_view.h"
+
+namespace rttr
+{
+
+class variant;
+
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A function, which converts the value at \p source into the target type
+ * and assigns the result to \p target. The given range checks of \ref convert_from are applied.
+ */
+using basic_conversion_func = bool (*)(const void* source, variant& target);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the conversion function for the built-in conversion from \p source to \p target.
+ *
+ * The lookup is done in a dense table, which is indexed by the two kinds.
+ * When no built-in conversion exists (e.g. the target is a custom type or an enum to string conversion,
+ * which needs the registered enumeration names), a nullptr is returned.
+ */
+RTTR_LOCAL basic_conversion_func get_basic_conversion_func(conversion_kind source, conversion_kind target) RTTR_NOEXCEPT;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A function, which parses the character sequence \p text into the target type
+ * and assigns the result to \p target.
+ */
+using from_chars_func = bool (*)(string_view text, variant& target);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the function for parsing a character sequence into the given \p target kind.
+ *
+ * When \p target is not a built-in arithmetic type, std::string or \ref interned_string, a nullptr is returned.
+ */
+RTTR_LOCAL from_chars_func get_from_chars_func(conversion_kind target) RTTR_NOEXCEPT;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_CONVERSION_MATRIX_H_
@@ -31,6 +31,7 @@
 #include "rttr/detail/conversion/std_conversion_functions.h"
 #include "rttr/detail/conversion/number_conversion.h"
 #include "rttr/detail/enumeration/enumeration_helper.h"
+#include "rttr/interned_string.h"
 
 namespace rttr
 {
@@ -86,11 +87,23 @@ struct default_type_converter
             return Type_Converter::to(value, arg.get_value<double>());
         else if (target_type == type::get<std::string>())
             return Type_Converter::to(value, arg.get_value<std::string>());
+        else if (target_type == type::get<interned_string>())
+            return to_interned_string(value, arg.get_value<interned_string>());
         else if (is_variant_with_enum(arg))
             return Type_Converter::to_enum(value, arg);
         else
             return false;
     }
+
+    static RTTR_INLINE bool to_interned_string(const T& value, interned_string& to)
+    {
+        std::string text;
+        if (!Type_Converter::to(value, text))
+            return false;
+
+        to = interned_string(text);
+        return true;
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -1197,27 +1210,26 @@ struct RTTR_API convert_from<double>
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<>
-struct RTTR_API convert_from<std::string>
+struct RTTR_API convert_from<string_view>
 {
-    static RTTR_INLINE bool to(const std::string& from, bool& to)
+    static RTTR_INLINE bool to(const string_view& from, bool& to)
     {
         bool ok;
         to = string_to_bool(from, &ok);
         return ok;
     }
 
-    static RTTR_INLINE bool to(const std::string& from, char& to)
+    static RTTR_INLINE bool to(const string_view& from, char& to)
     {
-        const auto& val = from;
-        if (val.empty())
+        if (from.empty())
             to ='\0';
         else
-            to = val[0];
+            to = from[0];
 
         return true;
     }
 
-    static RTTR_INLINE bool to(const std::string& from, int8_t& to)
+    static RTTR_INLINE bool to(const string_view& from, int8_t& to)
     {
         bool ok;
         int val = string_to_int(from, &ok);
@@ -1227,7 +1239,7 @@ struct RTTR_API convert_from<std::string>
         return convert_to(val, to);
     }
 
-    static RTTR_INLINE bool to(const std::string& from, int16_t& to)
+    static RTTR_INLINE bool to(const string_view& from, int16_t& to)
     {
         bool ok;
         int val = string_to_int(from, &ok);
@@ -1237,21 +1249,21 @@ struct RTTR_API convert_from<std::string>
         return convert_to(val, to);
     }
 
-    static RTTR_INLINE bool to(const std::string& from, int32_t& to)
+    static RTTR_INLINE bool to(const string_view& from, int32_t& to)
     {
         bool ok;
         to = string_to_int(from, &ok);
         return ok;
     }
 
-    static RTTR_INLINE bool to(const std::string& from, int64_t& to)
+    static RTTR_INLINE bool to(const string_view& from, int64_t& to)
     {
         bool ok;
         to = string_to_long_long(from, &ok);
         return ok;
     }
 
-    static RTTR_INLINE bool to(const std::string& from, uint8_t& to)
+    static RTTR_INLINE bool to(const string_view& from, uint8_t& to)
     {
         bool ok;
         unsigned int val = string_to_int(from, &ok);
@@ -1261,7 +1273,7 @@ struct RTTR_API convert_from<std::string>
         return convert_to(val, to);
     }
 
-    static RTTR_INLINE bool to(const std::string& from, uint16_t& to)
+    static RTTR_INLINE bool to(const string_view& from, uint16_t& to)
     {
         bool ok;
         unsigned int val = string_to_int(from, &ok);
@@ -1271,7 +1283,7 @@ struct RTTR_API convert_from<std::string>
         return convert_to(val, to);
     }
 
-    static RTTR_INLINE bool to(const std::string& from, uint32_t& to)
+    static RTTR_INLINE bool to(const string_view& from, uint32_t& to)
     {
         bool ok;
         const auto val = string_to_ulong(from, &ok);
@@ -1281,7 +1293,7 @@ struct RTTR_API convert_from<std::string>
         return convert_to(val, to);
     }
 
-    static RTTR_INLINE bool to(const std::string& from, uint64_t& to)
+    static RTTR_INLINE bool to(const string_view& from, uint64_t& to)
     {
         bool ok;
         const auto val = string_to_ulong_long(from, &ok);
@@ -1291,31 +1303,54 @@ struct RTTR_API convert_from<std::string>
         return convert_to(val, to);
     }
 
-    static RTTR_INLINE bool to(const std::string& from, float& to)
+    static RTTR_INLINE bool to(const string_view& from, float& to)
     {
         bool ok;
         to = string_to_float(from, &ok);
         return ok;
     }
 
-    static RTTR_INLINE bool to(const std::string& from, double& to)
+    static RTTR_INLINE bool to(const string_view& from, double& to)
     {
         bool ok;
         to = string_to_double(from, &ok);
         return ok;
     }
 
-    static RTTR_INLINE bool to(const std::string& from, std::string& to)
+    static RTTR_INLINE bool to(const string_view& from, std::string& to)
     {
-        to = from;
+        to = from.to_string();
         return true;
     }
 
-    static RTTR_INLINE bool to_enum(const std::string& from, argument& to)
+    static RTTR_INLINE bool to(const string_view& from, interned_string& to)
     {
-        return to_enumeration(string_view(from), to);
+        to = interned_string(from);
+        return true;
+    }
+
+    static RTTR_INLINE bool to_enum(const string_view& from, argument& to)
+    {
+        return to_enumeration(from, to);
     }
+};
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A std::string or an interned_string is parsed like any other character sequence,
+ * therefore all conversions are forwarded to the overloads for \ref string_view.
+ */
+template<>
+struct RTTR_API convert_from<std::string> : convert_from<string_view>
+{
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<>
+struct RTTR_API convert_from<interned_string> : convert_from<string_view>
+{
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -69,6 +69,21 @@ template<typename T, bool Can_Place = (sizeof(T) <= sizeof(variant_data)) &&
                                       (std::alignment_of<T>::value <= std::alignment_of<variant_data>::value)>
 using can_place_in_variant = std::integral_constant<bool, Can_Place>;
 
+/*!
+ * Returns `true` for the string types, which do not own their characters.
+ * They have the same built-in conversions as std::string, but do not need its special policy.
+ */
+template<typename T>
+using is_non_owning_string = std::integral_constant<bool, std::is_same<T, interned_string>::value ||
+                                                          std::is_same<T, string_view>::value>;
+
+template<typename T>
+using variant_policy_non_owning_string = conditional_t<can_place_in_variant<T>::value,
+                                                       variant_data_policy_small<T, default_type_converter<T>>,
+                                                       variant_data_policy_big<T, default_type_converter<T>>>;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 /*!
  * This template alias will determine the manager class for the given type \p T which is placed inside the variant.
  *
@@ -76,6 +91,7 @@ using can_place_in_variant = std::integral_constant<bool, Can_Place>;
  * This will improve the performance a lot.
  *
  * \remark Raw char arrays with rank equal to one, will be copied to a std::string.
+ *         An \ref interned_string is placed inside the variant, a \ref string_view (which is too big) is allocated.
  *
  * \return The manager class for the type T.
  */
@@ -86,24 +102,27 @@ using variant_policy = conditional_t<std::is_same<T, void_variant_type>::value,
                                                    variant_data_policy_nullptr_t,
                                                    conditional_t<std::is_same<T, std::string>::value || is_one_dim_char_array<T>::value,
                                                                  variant_data_policy_string,
-                                                                 conditional_t<can_place_in_variant<T>::value,
-                                                                               conditional_t<std::is_arithmetic<T>::value,
-                                                                                             variant_data_policy_arithmetic<T>,
+                                                                 conditional_t<is_non_owning_string<T>::value,
+                                                                               variant_policy_non_owning_string<T>,
+                                                                               conditional_t<can_place_in_variant<T>::value,
+                                                                                             conditional_t<std::is_arithmetic<T>::value,
+                                                                                                           variant_data_policy_arithmetic<T>,
+                                                                                                           conditional_t<std::is_array<T>::value,
+                                                                                                                         variant_data_policy_array_small<T>,
+                                                                                                                         conditional_t<std::is_enum<T>::value,
+                                                                                                                                       variant_data_policy_small<T, default_type_converter<T, convert_from_enum<T>>>,
+                                                                                                                                       variant_data_policy_small<T>
+                                                                                                                                      >
+                                                                                                                        >
+                                                                                                          >,
                                                                                              conditional_t<std::is_array<T>::value,
-                                                                                                           variant_data_policy_array_small<T>,
+                                                                                                           variant_data_policy_array_big<T>,
                                                                                                            conditional_t<std::is_enum<T>::value,
-                                                                                                                         variant_data_policy_small<T, default_type_converter<T, convert_from_enum<T>>>,
-                                                                                                                         variant_data_policy_small<T>
+                                                                                                                         variant_data_policy_big<T, default_type_converter<T, convert_from_enum<T>>>,
+                                                                                                                         variant_data_policy_big<T>
                                                                                                                         >
                                                                                                           >
-                                                                                            >,
-                                                                                conditional_t<std::is_array<T>::value,
-                                                                                              variant_data_policy_array_big<T>,
-                                                                                              conditional_t<std::is_enum<T>::value,
-                                                                                                            variant_data_policy_big<T, default_type_converter<T, convert_from_enum<T>>>,
-                                                                                                            variant_data_policy_big<T>
-                                                                                                           >
-                                                                                             >
+                                                                                            >
                                                                               >
                                                                 >
                                                   >
@@ -121,6 +140,7 @@ enum class variant_policy_operation : uint8_t
     DESTROY,
     CLONE,
     SWAP,
+    ASSIGN,
     EXTRACT_WRAPPED_VALUE,
     GET_VALUE,
     GET_TYPE,
@@ -180,6 +200,25 @@ static RTTR_INLINE is_nullptr(T& to)
     return false;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+enable_if_t<std::is_copy_assignable<T>::value, bool>
+static RTTR_INLINE assign_value(const T& from, T& to)
+{
+    to = from;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+enable_if_t<!std::is_copy_assignable<T>::value, bool>
+static RTTR_INLINE assign_value(const T& from, T& to)
+{
+    return false;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 #if RTTR_COMPILER == RTTR_COMPILER_MSVC && RTTR_COMP_VER <= 1800
@@ -240,6 +279,10 @@ struct variant_data_base_policy
                 Tp::swap(const_cast<T&>(Tp::get_value(src_data)), arg.get_value<variant_data>());
                 break;
             }
+            case variant_policy_operation::ASSIGN:
+            {
+                return assign_value(Tp::get_value(src_data), const_cast<T&>(Tp::get_value(arg.get_value<variant_data>())));
+            }
             case variant_policy_operation::EXTRACT_WRAPPED_VALUE:
             {
                 arg.get_value<variant>() = get_wrapped_value(Tp::get_value(src_data));
@@ -290,7 +333,7 @@ struct variant_data_base_policy
             }
             case variant_policy_operation::TO_ARRAY:
             {
-                arg.get_value<std::unique_ptr<array_wrapper_base>&>() = create_variant_array_view(const_cast<T&>(Tp::get_value(src_data)));
+                create_variant_array_view(const_cast<T&>(Tp::get_value(src_data)), arg.get_value<array_wrapper_storage&>());
                 break;
             }
             case variant_policy_operation::CREATE_ASSOCIATIV_VIEW:
@@ -406,6 +449,12 @@ struct variant_data_policy_small : variant_data_base_policy<T, variant_data_poli
     {
         new (&dest) T(std::forward<U>(value));
     }
+
+    template<typename... Args>
+    static RTTR_INLINE T& emplace(variant_data& dest, Args&&... args)
+    {
+        return *new (&dest) T(std::forward<Args>(args)...);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -443,6 +492,14 @@ struct variant_data_policy_big : variant_data_base_policy<T, variant_data_policy
     {
         reinterpret_cast<T*&>(dest) = new T(std::forward<U>(value));
     }
+
+    template<typename... Args>
+    static RTTR_INLINE T& emplace(variant_data& dest, Args&&... args)
+    {
+        T* value = new T(std::forward<Args>(args)...);
+        reinterpret_cast<T*&>(dest) = value;
+        return *value;
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -567,6 +624,13 @@ struct variant_data_policy_arithmetic : variant_data_base_policy<T, variant_data
     {
         reinterpret_cast<T&>(dest) = value;
     }
+
+    template<typename... Args>
+    static RTTR_INLINE T& emplace(variant_data& dest, Args&&... args)
+    {
+        reinterpret_cast<T&>(dest) = T(std::forward<Args>(args)...);
+        return reinterpret_cast<T&>(dest);
+    }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -607,6 +671,7 @@ struct RTTR_API variant_data_policy_empty
             case variant_policy_operation::DESTROY:
             case variant_policy_operation::CLONE:
             case variant_policy_operation::SWAP:
+            case variant_policy_operation::ASSIGN:
             case variant_policy_operation::EXTRACT_WRAPPED_VALUE:
             {
                 break;
@@ -712,6 +777,7 @@ struct RTTR_API variant_data_policy_void
             case variant_policy_operation::DESTROY:
             case variant_policy_operation::CLONE:
             case variant_policy_operation::SWAP:
+            case variant_policy_operation::ASSIGN:
             case variant_policy_operation::EXTRACT_WRAPPED_VALUE:
             {
                 break;
@@ -852,6 +918,7 @@ struct RTTR_API variant_data_policy_nullptr_t
                 swap(get_value(src_data), arg.get_value<variant_data>());
                 break;
             }
+            case variant_policy_operation::ASSIGN:
             case variant_policy_operation::EXTRACT_WRAPPED_VALUE:
             {
                 break;
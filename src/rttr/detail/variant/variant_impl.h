@@ -71,12 +71,52 @@ RTTR_INLINE variant::~variant()
 template<typename T, typename Tp>
 RTTR_INLINE variant& variant::operator=(T&& other)
 {
-    *this = variant(std::forward<T>(other));
+    if (!try_assign_in_place<Tp>(std::forward<T>(other)))
+        *this = variant(std::forward<T>(other));
+
     return *this;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+template<typename Tp, typename T>
+RTTR_INLINE detail::enable_if_t<detail::can_assign_in_place<Tp, T>::value, bool> variant::try_assign_in_place(T&& value)
+{
+    using policy = detail::variant_policy<Tp>;
+    if (m_policy != &policy::invoke)
+        return false;
+
+    const_cast<Tp&>(policy::get_value(m_data)) = std::forward<T>(value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Tp, typename T>
+RTTR_INLINE detail::enable_if_t<!detail::can_assign_in_place<Tp, T>::value, bool> variant::try_assign_in_place(T&& value)
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename... Args>
+RTTR_INLINE T& variant::emplace(Args&&... args)
+{
+    static_assert(!std::is_array<T>::value, "Raw arrays cannot be constructed in place, assign the array instead.");
+    using policy = detail::variant_policy<T>;
+
+    m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
+    // stays invalid, when the constructor of 'T' throws
+    m_policy = &detail::variant_data_policy_empty::invoke;
+
+    T& value = policy::emplace(m_data, std::forward<Args>(args)...);
+    m_policy = &policy::invoke;
+    return value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 RTTR_INLINE bool variant::operator==(const variant& other) const
 {
     return compare_equal(other);
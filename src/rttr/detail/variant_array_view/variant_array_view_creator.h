@@ -33,18 +33,16 @@
 #include "rttr/detail/array/array_wrapper_base.h"
 #include "rttr/detail/variant_array_view/variant_array_view_traits.h"
 
-#include <memory>
-
 namespace rttr
 {
 namespace detail
 {
 
 template<typename T, typename Tp = decay_except_array_t<T>>
-typename std::enable_if<can_create_array_container<T>::value, std::unique_ptr<array_wrapper_base>>::type create_variant_array_view(T&& value);
+typename std::enable_if<can_create_array_container<T>::value>::type create_variant_array_view(T&& value, array_wrapper_storage& storage);
 
 template<typename T, typename Tp = decay_except_array_t<T>>
-typename std::enable_if<!can_create_array_container<T>::value, std::unique_ptr<array_wrapper_base>>::type create_variant_array_view(T&& value);
+typename std::enable_if<!can_create_array_container<T>::value>::type create_variant_array_view(T&& value, array_wrapper_storage& storage);
 
 } // end namespace detail
 } // end namespace rttr
@@ -38,19 +38,23 @@ namespace detail
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename T, typename Tp>
-typename std::enable_if<can_create_array_container<T>::value, std::unique_ptr<array_wrapper_base>>::type
-create_variant_array_view(T&& value)
+typename std::enable_if<can_create_array_container<T>::value>::type
+create_variant_array_view(T&& value, array_wrapper_storage& storage)
 {
-    return detail::make_unique<array_wrapper<Tp>>(wrapped_raw_addressof(value));
+    static_assert(sizeof(array_wrapper<Tp>) <= sizeof(array_wrapper_storage), "The array wrapper does not fit into the inline storage.");
+
+    reinterpret_cast<array_wrapper_base*>(&storage)->~array_wrapper_base();
+    new (&storage) array_wrapper<Tp>(wrapped_raw_addressof(value));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename T, typename Tp>
-typename std::enable_if<!can_create_array_container<T>::value, std::unique_ptr<array_wrapper_base>>::type
-create_variant_array_view(T&& value)
+typename std::enable_if<!can_create_array_container<T>::value>::type
+create_variant_array_view(T&& value, array_wrapper_storage& storage)
 {
-    return detail::make_unique<array_wrapper_base>();
+    reinterpret_cast<array_wrapper_base*>(&storage)->~array_wrapper_base();
+    new (&storage) array_wrapper_base();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
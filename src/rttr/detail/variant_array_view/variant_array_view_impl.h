@@ -39,49 +39,132 @@ namespace rttr
 /////////////////////////////////////////////////////////////////////////////////
 
 RTTR_INLINE variant_array_view::variant_array_view() RTTR_NOEXCEPT
-:    m_array_wrapper(detail::make_unique<detail::array_wrapper_base>())
 {
+    new (&m_array_wrapper_storage) detail::array_wrapper_base();
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
 RTTR_INLINE variant_array_view::variant_array_view(const variant_array_view& other) RTTR_NOEXCEPT
-:   m_array_wrapper(std::move(other.m_array_wrapper->clone()))
 {
-
+    other.get_array_wrapper()->clone(m_array_wrapper_storage);
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
 RTTR_INLINE variant_array_view::variant_array_view(variant_array_view&& other) RTTR_NOEXCEPT
-:   m_array_wrapper(std::move(other.m_array_wrapper))
 {
-
+    // the wrapper holds only the address of the array, so moving is the same as copying
+    other.get_array_wrapper()->clone(m_array_wrapper_storage);
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
 RTTR_INLINE variant_array_view::~variant_array_view() RTTR_NOEXCEPT
 {
+    get_array_wrapper()->~array_wrapper_base();
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
 RTTR_INLINE void variant_array_view::swap(variant_array_view& other) RTTR_NOEXCEPT
 {
-    std::swap(m_array_wrapper, other.m_array_wrapper);
+    detail::array_wrapper_storage tmp;
+    get_array_wrapper()->clone(tmp);
+    get_array_wrapper()->~array_wrapper_base();
+
+    other.get_array_wrapper()->clone(m_array_wrapper_storage);
+    other.get_array_wrapper()->~array_wrapper_base();
+
+    auto tmp_wrapper = reinterpret_cast<detail::array_wrapper_base*>(&tmp);
+    tmp_wrapper->clone(other.m_array_wrapper_storage);
+    tmp_wrapper->~array_wrapper_base();
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
 RTTR_INLINE variant_array_view& variant_array_view::operator=(const variant_array_view& other) RTTR_NOEXCEPT
 {
-    variant_array_view(other).swap(*this);
+    if (this != &other)
+    {
+        get_array_wrapper()->~array_wrapper_base();
+        other.get_array_wrapper()->clone(m_array_wrapper_storage);
+    }
     return *this;
 }
 
 /////////////////////////////////////////////////////////////////////////////////
 
+template<std::size_t N>
+RTTR_INLINE std::size_t variant_array_view::get_size_variadic(const std::array<std::size_t, N>& index_list) const RTTR_NOEXCEPT
+{
+    return get_array_wrapper()->get_size_variadic(detail::index_list_view(index_list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+RTTR_INLINE bool variant_array_view::set_size_variadic(std::size_t new_size, const std::array<std::size_t, N>& index_list)
+{
+    return get_array_wrapper()->set_size_variadic(new_size, detail::index_list_view(index_list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+RTTR_INLINE bool variant_array_view::set_value_variadic(const std::array<std::size_t, N>& index_list, argument arg)
+{
+    return get_array_wrapper()->set_value_variadic(detail::index_list_view(index_list), arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+RTTR_INLINE variant variant_array_view::get_value_variadic(const std::array<std::size_t, N>& index_list) const
+{
+    return get_array_wrapper()->get_value_variadic(detail::index_list_view(index_list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+RTTR_INLINE bool variant_array_view::insert_value_variadic(const std::array<std::size_t, N>& index_list, argument arg)
+{
+    return get_array_wrapper()->insert_value_variadic(detail::index_list_view(index_list), arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<std::size_t N>
+RTTR_INLINE bool variant_array_view::remove_value_variadic(const std::array<std::size_t, N>& index_list)
+{
+    return get_array_wrapper()->remove_value_variadic(detail::index_list_view(index_list));
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+RTTR_INLINE bool variant_array_view::assign_from(const T* data, std::size_t count)
+{
+    return assign_from(static_cast<const void*>(data), count, type::get<T>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE detail::array_wrapper_base* variant_array_view::get_array_wrapper() RTTR_NOEXCEPT
+{
+    return reinterpret_cast<detail::array_wrapper_base*>(&m_array_wrapper_storage);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE const detail::array_wrapper_base* variant_array_view::get_array_wrapper() const RTTR_NOEXCEPT
+{
+    return reinterpret_cast<const detail::array_wrapper_base*>(&m_array_wrapper_storage);
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace rttr
 
 #endif // RTTR_VARIANT_ARRAY_VIEW_IMPL_H_
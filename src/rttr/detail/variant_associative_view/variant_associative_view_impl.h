@@ -0,0 +1,111 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_VARIANT_ASSOCIATIVE_VIEW_IMPL_H_
+#define RTTR_VARIANT_ASSOCIATIVE_VIEW_IMPL_H_
+
+#include "rttr/variant.h"
+#include "rttr/argument.h"
+
+#include <type_traits>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+using is_convertible_key = std::integral_constant<bool, std::is_copy_constructible<T>::value || std::is_array<T>::value>;
+
+template<typename T>
+RTTR_INLINE enable_if_t<is_convertible_key<T>::value, variant>
+convert_associative_key(const T& key, const type& key_type)
+{
+    variant var = key;
+    if (var.convert(key_type))
+        return var;
+    else
+        return variant();
+}
+
+template<typename T>
+RTTR_INLINE enable_if_t<!is_convertible_key<T>::value, variant>
+convert_associative_key(const T& key, const type& key_type)
+{
+    return variant();
+}
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename Tp>
+RTTR_INLINE variant_associative_view::const_iterator variant_associative_view::find(const Key& key)
+{
+    argument arg(key);
+    if (arg.get_type() == get_key_type())
+        return find(arg);
+
+    variant converted_key = detail::convert_associative_key(key, get_key_type());
+    return find(argument(converted_key));
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename Tp>
+RTTR_INLINE std::size_t variant_associative_view::erase(const Key& key)
+{
+    argument arg(key);
+    if (arg.get_type() == get_key_type())
+        return erase(arg);
+
+    variant converted_key = detail::convert_associative_key(key, get_key_type());
+    return erase(argument(converted_key));
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+template<typename Key, typename Tp>
+RTTR_INLINE std::pair<variant_associative_view::const_iterator, variant_associative_view::const_iterator>
+variant_associative_view::equal_range(const Key& key)
+{
+    argument arg(key);
+    if (arg.get_type() == get_key_type())
+        return equal_range(arg);
+
+    variant converted_key = detail::convert_associative_key(key, get_key_type());
+    return equal_range(argument(converted_key));
+}
+
+/////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_VARIANT_ASSOCIATIVE_VIEW_IMPL_H_
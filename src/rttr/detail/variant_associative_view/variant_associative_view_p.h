@@ -31,6 +31,7 @@
 #include "rttr/variant.h"
 #include "rttr/argument.h"
 #include "rttr/instance.h"
+#include "rttr/array_range.h"
 #include "rttr/associative_mapper.h"
 
 namespace rttr
@@ -57,13 +58,18 @@ class RTTR_LOCAL variant_associative_view_private
             m_delete_func(associative_container_empty::destroy),
             m_get_key_func(associative_container_empty::get_key),
             m_get_value_func(associative_container_empty::get_value),
+            m_get_key_ref_func(associative_container_empty::get_key_ref),
+            m_get_value_ref_func(associative_container_empty::get_value_ref),
             m_advance_func(associative_container_empty::advance),
             m_find_func(associative_container_empty::find),
             m_erase_func(associative_container_empty::erase),
             m_clear_func(associative_container_empty::clear),
             m_equal_range_func(associative_container_empty::equal_range),
             m_insert_func_key(associative_container_empty::insert_key),
-            m_insert_func_key_value(associative_container_empty::insert_key_value)
+            m_insert_func_key_value(associative_container_empty::insert_key_value),
+            m_reserve_func(associative_container_empty::reserve),
+            m_insert_range_func_key(associative_container_empty::insert_range_key),
+            m_insert_range_func_key_value(associative_container_empty::insert_range_key_value)
         {
         }
 
@@ -81,13 +87,18 @@ class RTTR_LOCAL variant_associative_view_private
             m_delete_func(associative_container_mapper<RawType, ConstType>::destroy),
             m_get_key_func(associative_container_mapper<RawType, ConstType>::get_key),
             m_get_value_func(associative_container_mapper<RawType, ConstType>::get_value),
+            m_get_key_ref_func(associative_container_mapper<RawType, ConstType>::get_key_ref),
+            m_get_value_ref_func(associative_container_mapper<RawType, ConstType>::get_value_ref),
             m_advance_func(associative_container_mapper<RawType, ConstType>::advance),
             m_find_func(associative_container_mapper<RawType, ConstType>::find),
             m_erase_func(associative_container_mapper<RawType, ConstType>::erase),
             m_clear_func(associative_container_mapper<RawType, ConstType>::clear),
             m_equal_range_func(associative_container_mapper<RawType, ConstType>::equal_range),
             m_insert_func_key(associative_container_mapper<RawType, ConstType>::insert_key),
-            m_insert_func_key_value(associative_container_mapper<RawType, ConstType>::insert_key_value)
+            m_insert_func_key_value(associative_container_mapper<RawType, ConstType>::insert_key_value),
+            m_reserve_func(associative_container_mapper<RawType, ConstType>::reserve),
+            m_insert_range_func_key(associative_container_mapper<RawType, ConstType>::insert_range_key),
+            m_insert_range_func_key_value(associative_container_mapper<RawType, ConstType>::insert_range_key_value)
         {
         }
 
@@ -158,6 +169,16 @@ class RTTR_LOCAL variant_associative_view_private
             return {m_get_key_func(itr), m_get_value_func(itr)};
         }
 
+        RTTR_FORCE_INLINE instance get_key_ref(const iterator_data& itr) const
+        {
+            return m_get_key_ref_func(itr);
+        }
+
+        RTTR_FORCE_INLINE instance get_value_ref(const iterator_data& itr) const
+        {
+            return m_get_value_ref_func(itr);
+        }
+
 
         RTTR_FORCE_INLINE void advance(iterator_data& itr, std::ptrdiff_t index) const
         {
@@ -195,6 +216,21 @@ class RTTR_LOCAL variant_associative_view_private
             return m_insert_func_key_value(m_container, key, value, itr);
         }
 
+        RTTR_INLINE bool reserve(std::size_t size)
+        {
+            return m_reserve_func(m_container, size);
+        }
+
+        RTTR_INLINE std::size_t insert_range(const array_range<argument>& keys)
+        {
+            return m_insert_range_func_key(m_container, keys);
+        }
+
+        RTTR_INLINE std::size_t insert_range(const array_range<argument>& keys, const array_range<argument>& values)
+        {
+            return m_insert_range_func_key_value(m_container, keys, values);
+        }
+
     private:
         static bool equal_cmp_dummy_func(const iterator_data& lhs_itr, const iterator_data& rhs_itr) RTTR_NOEXCEPT;
         using equality_func     = decltype(&equal_cmp_dummy_func); // workaround because of 'noexcept' can only appear on function declaration
@@ -207,6 +243,8 @@ class RTTR_LOCAL variant_associative_view_private
         using delete_func       = void(*)(iterator_data& itr);
         using get_key_func      = variant (*)(const iterator_data& itr);
         using get_value_func    = variant (*)(const iterator_data& itr);
+        using get_key_ref_func  = instance (*)(const iterator_data& itr);
+        using get_value_ref_func = instance (*)(const iterator_data& itr);
         using clear_func        = void(*)(void* container);
         using erase_func        = std::size_t(*)(void* container, argument& key);
         using find_func         = void(*)(void* container, detail::iterator_data& itr, argument& key);
@@ -214,6 +252,10 @@ class RTTR_LOCAL variant_associative_view_private
                                           detail::iterator_data& itr_begin, detail::iterator_data& itr_end);
         using insert_func_key   = bool(*)(void* container, argument& key, detail::iterator_data& itr);
         using insert_func_key_value = bool(*)(void* container, argument& key, argument& value, detail::iterator_data& itr);
+        using reserve_func      = bool(*)(void* container, std::size_t size);
+        using insert_range_func_key = std::size_t(*)(void* container, const array_range<argument>& keys);
+        using insert_range_func_key_value = std::size_t(*)(void* container, const array_range<argument>& keys,
+                                                           const array_range<argument>& values);
 
         type            m_type;
         type            m_key_type;
@@ -227,6 +269,8 @@ class RTTR_LOCAL variant_associative_view_private
         delete_func     m_delete_func;
         get_key_func    m_get_key_func;
         get_value_func  m_get_value_func;
+        get_key_ref_func m_get_key_ref_func;
+        get_value_ref_func m_get_value_ref_func;
         advance_func    m_advance_func;
         find_func       m_find_func;
         erase_func      m_erase_func;
@@ -234,6 +278,9 @@ class RTTR_LOCAL variant_associative_view_private
         equal_range_func m_equal_range_func;
         insert_func_key m_insert_func_key;
         insert_func_key_value m_insert_func_key_value;
+        reserve_func    m_reserve_func;
+        insert_range_func_key m_insert_range_func_key;
+        insert_range_func_key_value m_insert_range_func_key_value;
 };
 
 } // end namespace detail
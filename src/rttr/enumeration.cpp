@@ -112,6 +112,13 @@ variant enumeration::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant enumeration::get_metadata(const interned_string& key) const
+{
+    return m_wrapper->get_metadata(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 array_range<string_view> enumeration::get_names() const RTTR_NOEXCEPT
 {
     return m_wrapper->get_names();
@@ -140,6 +147,20 @@ variant enumeration::name_to_value(string_view name) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::string enumeration::value_to_flag_names(argument value) const
+{
+    return m_wrapper->value_to_flag_names(value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant enumeration::flag_names_to_value(string_view names) const
+{
+    return m_wrapper->flag_names_to_value(names);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool enumeration::operator==(const enumeration& other) const RTTR_NOEXCEPT
 {
     return (m_wrapper == other.m_wrapper);
@@ -31,6 +31,7 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/type.h"
 #include "rttr/string_view.h"
+#include "rttr/interned_string.h"
 #include "rttr/detail/misc/class_item_mapper.h"
 
 #include <memory>
@@ -64,6 +65,7 @@ namespace detail
  * When the \ref enumeration was declared inside a class, then \ref get_declaring_type() can be used to obtain the type of this class.
  *
  * The conversion functions \ref name_to_value(), \ref value_to_name() allow conversion between the value representation of an enumeration and its literal representation.
+ * For OR-combinations of enum values use \ref value_to_flag_names() and \ref flag_names_to_value(), which work with names like `"AlignLeft|AlignJustify"`.
  *
  * Copying and Assignment
  * ----------------------
@@ -158,6 +160,20 @@ class RTTR_API enumeration
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned \p key.
+         *
+         * Use this overload for keys which are queried very often, e.g. `static const interned_string key("NO_SERIALIZE");`.
+         * The key is compared by its identity, so no \ref variant is created and no string is compared.
+         *
+         * \remark Only meta data registered with a string key can be found with this function.
+         *         When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const interned_string& key) const;
+
         /*!
          * \brief Returns all enum names registered for this enumeration.
          *
@@ -192,6 +208,30 @@ class RTTR_API enumeration
          */
         variant name_to_value(string_view name) const;
 
+        /*!
+         * \brief Returns the names of all flags set in the given enumeration \p value, separated by `|`.
+         *
+         * When the whole \p value has a name, this name is returned; e.g. for a combined enumerator or for zero.
+         * Otherwise every set bit is converted to the name of the enumerator with this value, from the lowest to the highest bit.
+         * The \p value can be of the enum type, its underlying type or \ref enum_flags "enum_flags<Enum>".
+         *
+         * \remark When a set bit has no name or the \p value has an unsupported type, an empty string is returned.
+         *
+         * \return A string, containing the flag names for the given value; e.g. `"read|write"`.
+         */
+        std::string value_to_flag_names(argument value) const;
+
+        /*!
+         * \brief Returns the OR-combination of all enumerator \p names, which are separated by `|`.
+         *
+         * Spaces around the names are ignored, so `"read|write"` and `"read | write"` are equal.
+         *
+         * \remark When one of the names is not defined, an empty variant is returned.
+         *
+         * \return A variant object, containing the enum value for the given \p names.
+         */
+        variant flag_names_to_value(string_view names) const;
+
         /*!
          * \brief Returns true if this enumeration is the same like the \p other.
          *
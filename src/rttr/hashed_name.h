@@ -0,0 +1,101 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_HASHED_NAME_H_
+#define RTTR_HASHED_NAME_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref hashed_name class is a \ref string_view together with its hash value.
+ *
+ * When created from a string literal, the hash value is calculated at compile time.
+ * The type system uses the same hash algorithm for all registered names,
+ * so a lookup with a hashed_name will compare the hash values first and touch the characters only on a match.
+ *
+ * \remark A hashed_name does not own its characters, it is only a view.
+ *
+ * Typical Usage
+ * -------------
+ *
+ * \code{.cpp}
+ *      static RTTR_CONSTEXPR_OR_CONST hashed_name name("position");   // hashed at compile time
+ *      property prop = type::get<MyStruct>().get_property(name);
+ *
+ *      type::get_by_name("MyStruct");                                  // a string literal uses also a hashed_name
+ * \endcode
+ *
+ * \see type::get_property(const hashed_name&) const, type::get_method(const hashed_name&) const, type::get_by_name(const hashed_name&)
+ */
+class hashed_name
+{
+    public:
+        /*!
+         * \brief Constructs a hashed_name from the string literal \p text; the hash value is calculated at compile time.
+         */
+        template<std::size_t N>
+        explicit RTTR_CONSTEXPR hashed_name(const char (&text)[N]) RTTR_NOEXCEPT
+        :   m_text(text, detail::strlen_constexpr(text)),
+            m_hash(detail::generate_hash_constexpr(text, detail::strlen_constexpr(text)))
+        {
+        }
+
+        /*!
+         * \brief Constructs a hashed_name from the given \p text; the hash value is calculated at runtime.
+         */
+        explicit hashed_name(string_view text) RTTR_NOEXCEPT
+        :   m_text(text),
+            m_hash(detail::generate_hash(text.data(), text.size()))
+        {
+        }
+
+        /*!
+         * \brief Returns the characters of the name.
+         */
+        RTTR_CONSTEXPR string_view str() const RTTR_NOEXCEPT { return m_text; }
+
+        /*!
+         * \brief Returns the hash value of the name.
+         */
+        RTTR_CONSTEXPR std::size_t get_hash() const RTTR_NOEXCEPT { return m_hash; }
+
+    private:
+        string_view m_text;
+        std::size_t m_hash;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_HASHED_NAME_H_
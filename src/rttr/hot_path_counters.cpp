@@ -0,0 +1,319 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/hot_path_counters.h"
+#include "rttr/detail/misc/hot_path_counter.h"
+
+#if RTTR_HOT_PATH_COUNTERS
+
+#include "rttr/detail/type/type_register_p.h"
+#include "rttr/detail/constructor/constructor_wrapper_base.h"
+#include "rttr/detail/method/method_wrapper_base.h"
+#include "rttr/detail/property/property_wrapper_base.h"
+#include "rttr/detail/misc/flat_hash_map.h"
+#include "rttr/type.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#endif // RTTR_HOT_PATH_COUNTERS
+
+namespace rttr
+{
+namespace detail
+{
+
+#if RTTR_HOT_PATH_COUNTERS
+
+static RTTR_CONSTEXPR_OR_CONST std::size_t cache_line_size = 64;
+static RTTR_CONSTEXPR_OR_CONST std::size_t counter_kind_count = static_cast<std::size_t>(counter_kind::variant_convert) + 1;
+
+static_assert(sizeof(counter_slot) <= cache_line_size, "A counter slot has to fit into one cache line.");
+
+using counter_id     = std::pair<counter_kind, std::uintptr_t>;
+using counter_values = std::pair<uint64_t, uint64_t>; // count, ticks
+
+class counter_table;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Holds the counter tables of all running threads
+ * and the merged counters of the already finished threads.
+ */
+struct counter_registry
+{
+    std::mutex                              m_mutex;
+    std::vector<counter_table*>             m_table_list;
+    std::map<counter_id, counter_values>    m_finished_counters;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static counter_registry& get_counter_registry()
+{
+    static counter_registry registry;
+    return registry;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The counter slots of one thread.
+ *
+ * The lookup maps are only used by the owning thread.
+ * The slot list is also read by other threads while creating a snapshot, so adding a slot is guarded by a mutex.
+ */
+class counter_table
+{
+    public:
+        counter_table()
+        {
+            auto& registry = get_counter_registry();
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+            registry.m_table_list.push_back(this);
+        }
+
+        ~counter_table()
+        {
+            auto& registry = get_counter_registry();
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+            collect(registry.m_finished_counters);
+            registry.m_table_list.erase(std::remove(registry.m_table_list.begin(), registry.m_table_list.end(), this),
+                                        registry.m_table_list.end());
+        }
+
+        RTTR_FORCE_INLINE counter_slot& get_slot(counter_kind kind, std::uintptr_t key)
+        {
+            auto& slot_map = m_slot_map_list[static_cast<std::size_t>(kind)];
+            auto itr = slot_map.find(key);
+            if (itr != slot_map.end())
+                return *(*itr);
+
+            return create_slot(kind, key);
+        }
+
+        void collect(std::map<counter_id, counter_values>& counters)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto slot : m_slot_list)
+            {
+                auto& values = counters[counter_id(slot->m_kind, slot->m_key)];
+                values.first  += slot->m_count.load(std::memory_order_relaxed);
+                values.second += slot->m_ticks.load(std::memory_order_relaxed);
+            }
+        }
+
+        void reset()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto slot : m_slot_list)
+            {
+                slot->m_count.store(0, std::memory_order_relaxed);
+                slot->m_ticks.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        counter_slot& create_slot(counter_kind kind, std::uintptr_t key)
+        {
+            // the slot is placed at the begin of a cache line, in order to avoid false sharing with other threads
+            std::unique_ptr<unsigned char[]> buffer(new unsigned char[2 * cache_line_size]);
+            const auto address = (reinterpret_cast<std::uintptr_t>(buffer.get()) + cache_line_size - 1) & ~(cache_line_size - 1);
+            auto slot = new (reinterpret_cast<void*>(address)) counter_slot();
+            slot->m_count.store(0, std::memory_order_relaxed);
+            slot->m_ticks.store(0, std::memory_order_relaxed);
+            slot->m_key = key;
+            slot->m_kind = kind;
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_buffer_list.push_back(std::move(buffer));
+                m_slot_list.push_back(slot);
+            }
+
+            m_slot_map_list[static_cast<std::size_t>(kind)].insert(key, slot);
+            return *slot;
+        }
+
+    private:
+        std::mutex                                                                  m_mutex;
+        std::array<flat_hash_map<std::uintptr_t, counter_slot*>, counter_kind_count> m_slot_map_list;
+        std::vector<counter_slot*>                                                  m_slot_list;
+        std::vector<std::unique_ptr<unsigned char[]>>                               m_buffer_list;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+counter_slot& get_counter_slot(counter_kind kind, std::uintptr_t key)
+{
+    static thread_local counter_table table;
+    return table.get_slot(kind, key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the duration of one tick of \ref get_counter_ticks() in nanoseconds.
+ * The frequency of the time stamp counter is measured once against the steady clock.
+ */
+static double get_nanoseconds_per_tick()
+{
+#if RTTR_HOT_PATH_USE_TSC
+    static const double nanoseconds_per_tick = []()
+    {
+        using namespace std::chrono;
+        const auto start_time   = steady_clock::now();
+        const auto start_ticks  = get_counter_ticks();
+        std::this_thread::sleep_for(milliseconds(20));
+        const auto elapsed_ticks = get_counter_ticks() - start_ticks;
+        const auto elapsed_time  = duration_cast<nanoseconds>(steady_clock::now() - start_time).count();
+        return (elapsed_ticks > 0 ? static_cast<double>(elapsed_time) / static_cast<double>(elapsed_ticks) : 1.0);
+    }();
+    return nanoseconds_per_tick;
+#else
+    return 1.0;
+#endif
+}
+
+static std::string get_item_name(const type& declaring_type, string_view name)
+{
+    if (declaring_type.is_valid())
+        return declaring_type.get_name().to_string() + "::" + name.to_string();
+    else
+        return name.to_string();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string get_counter_name(counter_kind kind, std::uintptr_t key)
+{
+    switch (kind)
+    {
+        case counter_kind::method_invoke:
+        {
+            const auto wrapper = reinterpret_cast<const method_wrapper_base*>(key);
+            return get_item_name(wrapper->get_declaring_type(), wrapper->get_signature());
+        }
+        case counter_kind::property_get_value:
+        case counter_kind::property_set_value:
+        {
+            const auto wrapper = reinterpret_cast<const property_wrapper_base*>(key);
+            return get_item_name(wrapper->get_declaring_type(), wrapper->get_name());
+        }
+        case counter_kind::constructor_invoke:
+        {
+            const auto wrapper = reinterpret_cast<const constructor_wrapper_base*>(key);
+            return wrapper->get_signature().to_string();
+        }
+        case counter_kind::variant_convert:
+        {
+            const auto& type_list = type_register_private::get_type_storage();
+            const auto source_id = static_cast<std::size_t>(key >> 16);
+            const auto target_id = static_cast<std::size_t>(key & 0xFFFF);
+            if (source_id >= type_list.size() || target_id >= type_list.size())
+                return std::string();
+
+            return type_list[source_id].get_name().to_string() + " -> " + type_list[target_id].get_name().to_string();
+        }
+    }
+
+    return std::string();
+}
+
+#endif // RTTR_HOT_PATH_COUNTERS
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool hot_path_counters::is_enabled() RTTR_NOEXCEPT
+{
+    return (RTTR_HOT_PATH_COUNTERS != 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<counter_record> hot_path_counters::get_snapshot(std::size_t max_count)
+{
+    std::vector<counter_record> result;
+#if RTTR_HOT_PATH_COUNTERS
+    using namespace detail;
+
+    std::map<counter_id, counter_values> counters;
+    {
+        auto& registry = get_counter_registry();
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+        counters = registry.m_finished_counters;
+        for (const auto table : registry.m_table_list)
+            table->collect(counters);
+    }
+
+    const double nanoseconds_per_tick = get_nanoseconds_per_tick();
+    for (const auto& item : counters)
+    {
+        if (item.second.first == 0)
+            continue;
+
+        result.emplace_back(item.first.first, get_counter_name(item.first.first, item.first.second),
+                            item.second.first, static_cast<uint64_t>(static_cast<double>(item.second.second) * nanoseconds_per_tick));
+    }
+
+    std::stable_sort(result.begin(), result.end(), [](const counter_record& left, const counter_record& right)
+                                                   { return left.nanoseconds > right.nanoseconds; });
+    if (result.size() > max_count)
+        result.erase(result.begin() + max_count, result.end());
+#endif
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void hot_path_counters::reset()
+{
+#if RTTR_HOT_PATH_COUNTERS
+    using namespace detail;
+
+    auto& registry = get_counter_registry();
+    std::lock_guard<std::mutex> lock(registry.m_mutex);
+    registry.m_finished_counters.clear();
+    for (const auto table : registry.m_table_list)
+        table->reset();
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
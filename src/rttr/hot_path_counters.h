@@ -0,0 +1,121 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_HOT_PATH_COUNTERS_H_
+#define RTTR_HOT_PATH_COUNTERS_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref counter_kind specifies which function of RTTR was called.
+ *
+ * \see hot_path_counters
+ */
+enum class counter_kind
+{
+    method_invoke,          //!< \ref method::invoke() and \ref method::invoke_variadic()
+    property_get_value,     //!< \ref property::get_value()
+    property_set_value,     //!< \ref property::set_value()
+    constructor_invoke,     //!< \ref constructor::invoke() and \ref constructor::invoke_variadic()
+    variant_convert         //!< \ref variant::convert(const type&)
+};
+
+/*!
+ * The \ref counter_record struct holds the merged counter values of all threads for one reflected item.
+ */
+struct RTTR_API counter_record
+{
+    counter_record(counter_kind kind, std::string name, uint64_t count, uint64_t nanoseconds)
+    :   kind(kind), name(std::move(name)), count(count), nanoseconds(nanoseconds)
+    {}
+
+    //! The function, which was called.
+    counter_kind    kind;
+    //! The name of the item, e.g. `Foo::bar` for a property or `Foo::func( int )` for a method;
+    //! for a conversion the name of source and target type: `int -> std::string`.
+    std::string     name;
+    //! The number of calls.
+    uint64_t        count;
+    //! The accumulated wall time of all calls in nanoseconds;
+    //! on x86 it is measured in CPU cycles of the time stamp counter and converted afterwards.
+    uint64_t        nanoseconds;
+};
+
+/*!
+ * The \ref hot_path_counters class provides access to the counters, which RTTR maintains for its hot paths:
+ * \ref method::invoke(), \ref property::get_value(), \ref property::set_value(), \ref constructor::invoke()
+ * and \ref variant::convert(const type&).
+ *
+ * Every call increments a counter of the called item and adds the elapsed time to it.
+ * The counters are stored per thread, so the hot paths do not need any synchronization.
+ *
+ * The counters are only available, when RTTR was build with the CMake option `BUILD_WITH_HOT_PATH_COUNTERS`;
+ * then the macro `RTTR_HOT_PATH_COUNTERS` is defined to `1`.
+ * Otherwise the counting code is not compiled at all and \ref get_snapshot() always returns an empty list.
+ *
+ * A typical usage example is the following:
+ * \code{.cpp}
+ *   for (const auto& record : hot_path_counters::get_snapshot(10))
+ *       std::cout << record.name << ": " << record.count << " calls, " << record.nanoseconds << " ns" << std::endl;
+ * \endcode
+ */
+class RTTR_API hot_path_counters
+{
+    public:
+        /*!
+         * \brief Returns true, when RTTR was build with the hot path counters, otherwise false.
+         */
+        static bool is_enabled() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Merges the counters of all threads (including already finished threads)
+         *        and returns the \p max_count hottest items, sorted by the accumulated time in descending order.
+         *
+         * \return A list of counter records; an empty list, when the counters are not enabled.
+         */
+        static std::vector<counter_record> get_snapshot(std::size_t max_count);
+
+        /*!
+         * \brief Sets all counters of all threads back to zero.
+         *
+         * \remark Calls, which are running concurrently to this function, might still be counted.
+         */
+        static void reset();
+};
+
+} // end namespace rttr
+
+#endif // RTTR_HOT_PATH_COUNTERS_H_
@@ -0,0 +1,115 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/interned_string.h"
+#include "rttr/detail/misc/utility.h"
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace rttr
+{
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The global symbol table for all interned strings.
+ *
+ * The deques are only appended, so the addresses of their elements stay valid for the lifetime of the table.
+ */
+class interned_string_table
+{
+    public:
+        const detail::interned_string_data* intern(string_view text)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            const auto itr = m_lookup.find(text);
+            if (itr != m_lookup.end())
+                return itr->second;
+
+            m_storage.emplace_back(text.data(), text.size());
+            const std::string& storage = m_storage.back();
+            const string_view stored_text(storage.data(), storage.size());
+            m_entries.push_back(detail::interned_string_data{stored_text, detail::generate_hash(stored_text.data(), stored_text.size())});
+
+            const detail::interned_string_data* data = &m_entries.back();
+            m_lookup.emplace(stored_text, data);
+            return data;
+        }
+
+    private:
+        std::mutex                                                              m_mutex;
+        std::deque<std::string>                                                 m_storage;
+        std::deque<detail::interned_string_data>                                m_entries;
+        std::unordered_map<string_view, const detail::interned_string_data*>    m_lookup;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static interned_string_table& get_interned_string_table()
+{
+    static interned_string_table table;
+    return table;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The empty string is not part of the table, so that a default constructed interned_string never allocates.
+ */
+static const detail::interned_string_data* get_empty_interned_string_data() RTTR_NOEXCEPT
+{
+    static const detail::interned_string_data data = { string_view("", 0), detail::generate_hash("", 0) };
+    return &data;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+interned_string::interned_string() RTTR_NOEXCEPT
+:   m_data(get_empty_interned_string_data())
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+interned_string::interned_string(string_view text)
+:   m_data(text.empty() ? get_empty_interned_string_data() : get_interned_string_table().intern(text))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,157 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_INTERNED_STRING_H_
+#define RTTR_INTERNED_STRING_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+#include <functional>
+
+namespace rttr
+{
+namespace detail
+{
+struct interned_string_data;
+}
+
+/*!
+ * The \ref interned_string class is a handle to an immutable string, which is stored only once in a global symbol table.
+ *
+ * Creating an interned_string from a text, which was already interned before, will return a handle to the same entry.
+ * So the handle itself has only the size of a pointer and copying it will never allocate any memory.
+ * Two interned strings are equal, when they point to the same entry; no characters have to be compared.
+ *
+ * This makes the class a good fit for strings which occur over and over again,
+ * like names of enumerations, properties or categories in an event stream.
+ * Because an interned_string fits into the internal storage of a \ref variant, it will be stored there without any heap allocation.
+ *
+ * \remark The entries of the symbol table are never released; so do not intern arbitrary, unbounded user input.
+ *         The creation of an interned_string is thread safe.
+ *
+ * Typical Usage
+ * -------------
+ *
+ * \code{.cpp}
+ *      interned_string category("physics");
+ *      variant var = category;                     // no heap allocation
+ *
+ *      var == interned_string("physics");          // yields to 'true', just a pointer compare
+ *      var.to_string();                            // yields to "physics"
+ * \endcode
+ */
+class RTTR_API interned_string
+{
+    public:
+        /*!
+         * \brief Constructs an empty interned string.
+         */
+        interned_string() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Looks up the given \p text in the global symbol table
+         *        and adds it, when it is not already stored there.
+         */
+        explicit interned_string(string_view text);
+
+        /*!
+         * \brief Returns a view of the interned characters.
+         *        The view stays valid until the end of the program.
+         */
+        RTTR_INLINE string_view str() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Implicit conversion to \ref string_view.
+         *
+         * \see str()
+         */
+        RTTR_INLINE operator string_view() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns a pointer to the null-terminated interned characters.
+         */
+        RTTR_INLINE const char* c_str() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the number of characters.
+         */
+        RTTR_INLINE std::size_t size() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns `true` when the interned string has no characters; otherwise `false`.
+         */
+        RTTR_INLINE bool empty() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the hash value of the characters, which was calculated once during interning.
+         *
+         * \remark The value is the same as the one for a \ref string_view with the same characters.
+         */
+        RTTR_INLINE std::size_t get_hash() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns `true` when both handles refer to the same entry; otherwise `false`.
+         */
+        RTTR_INLINE bool operator==(const interned_string& other) const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns `true` when both handles refer to different entries; otherwise `false`.
+         */
+        RTTR_INLINE bool operator!=(const interned_string& other) const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Compares the characters lexicographically, so that the order does not depend on the order of interning.
+         */
+        RTTR_INLINE bool operator<(const interned_string& other) const RTTR_NOEXCEPT;
+
+    private:
+        const detail::interned_string_data* m_data;
+};
+
+/*!
+ * A \ref symbol is an \ref interned_string, which is used as name for lookups in the type system.
+ *
+ * Create a symbol once and reuse it, then the text is hashed only one time
+ * and the lookup compares the symbols by their identity instead of their characters.
+ *
+ * \code{.cpp}
+ *      static const symbol name_symbol("name");
+ *      property prop = type::get<MyStruct>().get_property(name_symbol);
+ * \endcode
+ *
+ * \see type::get_by_name(const symbol&), type::get_property(const symbol&) const, type::get_method(const symbol&) const
+ */
+using symbol = interned_string;
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/interned_string_impl.h"
+
+#endif // RTTR_INTERNED_STRING_H_
@@ -29,6 +29,7 @@
 #include "rttr/detail/method/method_wrapper_base.h"
 #include "rttr/argument.h"
 #include "rttr/instance.h"
+#include "rttr/detail/misc/hot_path_counter.h"
 
 using namespace std;
 
@@ -133,8 +134,16 @@ variant method::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant method::get_metadata(const interned_string& key) const
+{
+    return m_wrapper->get_metadata(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant method::invoke(instance object) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::method_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(object);
 }
 
@@ -142,6 +151,7 @@ variant method::invoke(instance object) const
 
 variant method::invoke(instance object, argument arg1) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::method_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(object, arg1);
 }
 
@@ -149,6 +159,7 @@ variant method::invoke(instance object, argument arg1) const
 
 variant method::invoke(instance object, argument arg1, argument arg2) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::method_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(object, arg1, arg2);
 }
 
@@ -156,6 +167,7 @@ variant method::invoke(instance object, argument arg1, argument arg2) const
 
 variant method::invoke(instance object, argument arg1, argument arg2, argument arg3) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::method_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(object, arg1, arg2, arg3);
 }
 
@@ -163,6 +175,7 @@ variant method::invoke(instance object, argument arg1, argument arg2, argument a
 
 variant method::invoke(instance object, argument arg1, argument arg2, argument arg3, argument arg4) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::method_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(object, arg1, arg2, arg3, arg4);
 }
 
@@ -171,6 +184,7 @@ variant method::invoke(instance object, argument arg1, argument arg2, argument a
 variant method::invoke(instance object, argument arg1, argument arg2, argument arg3, argument arg4,
                        argument arg5) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::method_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(object, arg1, arg2, arg3, arg4, arg5);
 }
 
@@ -179,6 +193,7 @@ variant method::invoke(instance object, argument arg1, argument arg2, argument a
 variant method::invoke(instance object, argument arg1, argument arg2, argument arg3, argument arg4,
                        argument arg5, argument arg6) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::method_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke(object, arg1, arg2, arg3, arg4, arg5, arg6);
 }
 
@@ -186,6 +201,7 @@ variant method::invoke(instance object, argument arg1, argument arg2, argument a
 
 variant method::invoke_variadic(instance object, std::vector<argument> args) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::method_invoke, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->invoke_variadic(object, args);
 }
 
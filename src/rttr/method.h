@@ -34,6 +34,7 @@
 #include "rttr/access_levels.h"
 #include "rttr/array_range.h"
 #include "rttr/string_view.h"
+#include "rttr/interned_string.h"
 
 #include <string>
 #include <vector>
@@ -202,6 +203,20 @@ class RTTR_API method
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned \p key.
+         *
+         * Use this overload for keys which are queried very often, e.g. `static const interned_string key("NO_SERIALIZE");`.
+         * The key is compared by its identity, so no \ref variant is created and no string is compared.
+         *
+         * \remark Only meta data registered with a string key can be found with this function.
+         *         When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const interned_string& key) const;
+
         /*!
          * \brief Invokes the method represented by the current instance \p object.
          *
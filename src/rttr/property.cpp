@@ -32,6 +32,7 @@
 #include "rttr/argument.h"
 #include "rttr/instance.h"
 #include "rttr/enumeration.h"
+#include "rttr/detail/misc/hot_path_counter.h"
 
 using namespace std;
 
@@ -144,6 +145,7 @@ type property::get_declaring_type() const RTTR_NOEXCEPT
 
 bool property::set_value(instance object, argument arg) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::property_set_value, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->set_value(object, arg);
 }
 
@@ -151,6 +153,7 @@ bool property::set_value(instance object, argument arg) const
 
 variant property::get_value(instance object) const
 {
+    RTTR_COUNT_HOT_PATH(counter_kind::property_get_value, reinterpret_cast<std::uintptr_t>(m_wrapper));
     return m_wrapper->get_value(object);
 }
 
@@ -163,6 +166,13 @@ variant property::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant property::get_metadata(const interned_string& key) const
+{
+    return m_wrapper->get_metadata(key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool property::operator==(const property& other) const RTTR_NOEXCEPT
 {
     return (m_wrapper == other.m_wrapper);
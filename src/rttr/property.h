@@ -33,6 +33,7 @@
 #include "rttr/parameter_info.h"
 #include "rttr/access_levels.h"
 #include "rttr/string_view.h"
+#include "rttr/interned_string.h"
 
 #include <string>
 
@@ -251,6 +252,20 @@ class RTTR_API property
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned \p key.
+         *
+         * Use this overload for keys which are queried very often, e.g. `static const interned_string key("NO_SERIALIZE");`.
+         * The key is compared by its identity, so no \ref variant is created and no string is compared.
+         *
+         * \remark Only meta data registered with a string key can be found with this function.
+         *         When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const interned_string& key) const;
+
         /*!
          * \brief Returns true if this property is the same like the \p other.
          *
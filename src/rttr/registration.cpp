@@ -27,6 +27,8 @@
 
 #include "rttr/registration.h"
 
+#include "rttr/detail/type/type_register_p.h"
+
 namespace rttr
 {
 
@@ -36,4 +38,11 @@ const detail::protected_access registration::protected_access = {};
 
 const detail::private_access registration::private_access = {};
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registration_statistics registration::get_statistics()
+{
+    return detail::type_register_private::get_statistics();
+}
+
 } // end namespace rttr
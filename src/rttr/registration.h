@@ -33,9 +33,11 @@
 #include "rttr/access_levels.h"
 #include "rttr/detail/registration/bind_types.h"
 #include "rttr/detail/registration/registration_executer.h"
+#include "rttr/detail/registration/registration_profile_scope.h"
 #include "rttr/detail/default_arguments/default_arguments.h"
 #include "rttr/detail/parameter_info/parameter_names.h"
 #include "rttr/variant.h"
+#include "rttr/registration_statistics.h"
 
 namespace rttr
 {
@@ -268,6 +270,7 @@ public:
             class_(const class_& other);
             class_& operator=(const class_& other);
         private:
+            detail::registration_profile_scope              m_profile_scope;
             std::shared_ptr<detail::registration_executer> m_reg_exec;
             template<typename...T>
             friend class bind;
@@ -356,6 +359,20 @@ public:
     template<typename Enum_Type>
     static bind<detail::enum_, void, Enum_Type> enumeration(string_view name);
 
+    /*!
+     * \brief Returns a snapshot of the memory, which is used by all registered reflection information.
+     *
+     * The memory is reported per category (types, properties, methods, metadata, names, ...)
+     * and per type, so it is possible to find out which registrations are the most expensive ones.
+     *
+     * \remark Only the registered data is taken into account, the memory of the library code itself is not part of it.
+     *
+     * \see registration_statistics
+     *
+     * \return The current memory usage of the registered reflection information.
+     */
+    static registration_statistics get_statistics();
+
     /////////////////////////////////////////////////////////////////////////////////////
 
     /*!
@@ -0,0 +1,340 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/registration_profiler.h"
+#include "rttr/detail/registration/registration_profile_scope.h"
+#include "rttr/type.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static RTTR_CONSTEXPR_OR_CONST std::size_t inactive_scope = static_cast<std::size_t>(-1);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string create_profile_report(const std::vector<registration_profile_record>& record_list);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The recorded scopes of all threads.
+ *
+ * The profiler is enabled via the environment variable 'RTTR_REGISTRATION_PROFILE',
+ * because the registration runs already before 'main()'.
+ */
+class profiler_data
+{
+    public:
+        profiler_data() : m_enabled(false)
+        {
+            const char* value = std::getenv("RTTR_REGISTRATION_PROFILE");
+            if (value && *value != '\0')
+            {
+                m_enabled.store(true, std::memory_order_relaxed);
+                if (std::string(value) != "1")
+                    m_file_name = value;
+            }
+        }
+
+        ~profiler_data()
+        {
+            if (m_file_name.empty())
+                return;
+
+            std::ofstream file(m_file_name.c_str());
+            file << create_profile_report(m_record_list);
+        }
+
+        std::atomic<bool>                           m_enabled;
+        std::string                                 m_file_name;
+        std::mutex                                  m_mutex;
+        std::vector<registration_profile_record>    m_record_list;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static profiler_data& get_profiler_data()
+{
+    static profiler_data data;
+    return data;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The indices of the active scopes of the current thread; the innermost scope is the last one.
+ */
+static std::vector<std::size_t>& get_active_scopes()
+{
+    static thread_local std::vector<std::size_t> scope_list;
+    return scope_list;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static uint64_t get_current_time() RTTR_NOEXCEPT
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static bool is_registration_profiled() RTTR_NOEXCEPT
+{
+    return get_profiler_data().m_enabled.load(std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void profile_registered_type() RTTR_NOEXCEPT
+{
+    if (!is_registration_profiled())
+        return;
+
+    auto& data = get_profiler_data();
+    std::lock_guard<std::mutex> lock(data.m_mutex);
+    for (const auto index : get_active_scopes())
+    {
+        if (index < data.m_record_list.size())
+            ++data.m_record_list[index].type_count;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void profile_registered_item(std::size_t allocated_bytes) RTTR_NOEXCEPT
+{
+    if (!is_registration_profiled())
+        return;
+
+    auto& data = get_profiler_data();
+    std::lock_guard<std::mutex> lock(data.m_mutex);
+    for (const auto index : get_active_scopes())
+    {
+        if (index < data.m_record_list.size())
+        {
+            ++data.m_record_list[index].item_count;
+            data.m_record_list[index].allocated_bytes += allocated_bytes;
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registration_profile_scope::registration_profile_scope() RTTR_NOEXCEPT
+:   m_index(inactive_scope),
+    m_start_time(0)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registration_profile_scope::registration_profile_scope(bool is_class_scope)
+:   m_index(inactive_scope),
+    m_start_time(0)
+{
+    if (is_class_scope)
+        start(false, std::string());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registration_profile_scope::registration_profile_scope(const char* file, int line)
+:   m_index(inactive_scope),
+    m_start_time(0)
+{
+    if (is_registration_profiled())
+        start(true, std::string(file) + ":" + std::to_string(line));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+registration_profile_scope::~registration_profile_scope()
+{
+    if (m_index == inactive_scope)
+        return;
+
+    const auto elapsed_time = get_current_time() - m_start_time;
+
+    // the scopes are always nested
+    auto& scope_list = get_active_scopes();
+    if (!scope_list.empty() && scope_list.back() == m_index)
+        scope_list.pop_back();
+
+    auto& data = get_profiler_data();
+    std::lock_guard<std::mutex> lock(data.m_mutex);
+    if (m_index < data.m_record_list.size())
+        data.m_record_list[m_index].nanoseconds = elapsed_time;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registration_profile_scope::set_type(const type& t)
+{
+    if (m_index == inactive_scope)
+        return;
+
+    auto& data = get_profiler_data();
+    std::lock_guard<std::mutex> lock(data.m_mutex);
+    if (m_index < data.m_record_list.size())
+        data.m_record_list[m_index].name = t.get_name().to_string();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registration_profile_scope::start(bool is_block, std::string name)
+{
+    if (!is_registration_profiled())
+        return;
+
+    auto& scope_list = get_active_scopes();
+    auto& data = get_profiler_data();
+    {
+        std::lock_guard<std::mutex> lock(data.m_mutex);
+        m_index = data.m_record_list.size();
+        data.m_record_list.emplace_back(is_block, std::move(name),
+                                        scope_list.empty() ? registration_profile_record::no_parent : scope_list.back());
+    }
+    scope_list.push_back(m_index);
+
+    m_start_time = get_current_time();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string escape_json_string(const std::string& text)
+{
+    std::string result;
+    result.reserve(text.size());
+    for (const char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+            result += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned int>(c));
+            result += buffer;
+        }
+        else
+        {
+            result += c;
+        }
+    }
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::string create_profile_report(const std::vector<registration_profile_record>& record_list)
+{
+    std::string report = "{\n  \"records\": [";
+    for (std::size_t index = 0; index < record_list.size(); ++index)
+    {
+        const auto& record = record_list[index];
+        report += (index == 0) ? "\n" : ",\n";
+        report += "    { \"kind\": \"";
+        report += record.is_block ? "block" : "class";
+        report += "\", \"name\": \"" + escape_json_string(record.name) + "\", \"parent\": ";
+        report += (record.parent_index == registration_profile_record::no_parent) ? std::string("-1") : std::to_string(record.parent_index);
+        report += ", \"nanoseconds\": " + std::to_string(record.nanoseconds);
+        report += ", \"types\": " + std::to_string(record.type_count);
+        report += ", \"items\": " + std::to_string(record.item_count);
+        report += ", \"allocated_bytes\": " + std::to_string(record.allocated_bytes) + " }";
+    }
+    report += "\n  ]\n}\n";
+    return report;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::size_t registration_profile_record::no_parent;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool registration_profiler::is_enabled() RTTR_NOEXCEPT
+{
+    return detail::is_registration_profiled();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registration_profiler::set_enabled(bool enabled) RTTR_NOEXCEPT
+{
+    detail::get_profiler_data().m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::vector<registration_profile_record> registration_profiler::get_records()
+{
+    auto& data = detail::get_profiler_data();
+    std::lock_guard<std::mutex> lock(data.m_mutex);
+    return data.m_record_list;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::string registration_profiler::get_report()
+{
+    return detail::create_profile_report(get_records());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void registration_profiler::clear()
+{
+    auto& data = detail::get_profiler_data();
+    std::lock_guard<std::mutex> lock(data.m_mutex);
+    data.m_record_list.clear();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
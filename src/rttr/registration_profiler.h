@@ -0,0 +1,124 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_REGISTRATION_PROFILER_H_
+#define RTTR_REGISTRATION_PROFILER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref registration_profile_record struct holds the measured costs of one registration scope.
+ *
+ * A scope is either a \ref RTTR_REGISTRATION block or the lifetime of a \ref registration::class_ object,
+ * which was created with a name. Class scopes are nested inside the block in which they are created.
+ */
+struct RTTR_API registration_profile_record
+{
+    //! The value of \ref parent_index for a scope, which has no enclosing scope.
+    static const std::size_t no_parent = static_cast<std::size_t>(-1);
+
+    registration_profile_record(bool is_block, std::string name, std::size_t parent_index)
+    :   is_block(is_block), name(std::move(name)), parent_index(parent_index),
+        nanoseconds(0), type_count(0), item_count(0), allocated_bytes(0)
+    {}
+
+    //! True for a \ref RTTR_REGISTRATION block, false for a \ref registration::class_ scope.
+    bool            is_block;
+    //! The source location `file:line` of a block, or the name of the class.
+    std::string     name;
+    //! The index of the enclosing scope in the record list, or \ref no_parent.
+    std::size_t     parent_index;
+    //! The elapsed wall time in nanoseconds.
+    uint64_t        nanoseconds;
+    //! The number of types, which were registered for the first time; this includes e.g. pointer and parameter types.
+    std::size_t     type_count;
+    //! The number of registered properties, methods, constructors, destructors and enumerations.
+    std::size_t     item_count;
+    //! The number of bytes, which RTTR allocated for the registered items.
+    std::size_t     allocated_bytes;
+};
+
+/*!
+ * The \ref registration_profiler class measures the costs of the registration, which runs mostly during startup
+ * in static initializers.
+ *
+ * The profiler is enabled by setting the environment variable `RTTR_REGISTRATION_PROFILE` before the process starts.
+ * When its value is not `1`, it is used as file name; the report is then written as JSON into this file,
+ * when the process exits.
+ *
+ * The report contains one record for every \ref RTTR_REGISTRATION block and every named \ref registration::class_ object.
+ * A block record includes the costs of all class records inside it.
+ *
+ * \remark The allocated bytes are the memory of the created reflection items (see \ref registration::get_statistics()),
+ *         allocations which are done by the registered code itself are not counted.
+ */
+class RTTR_API registration_profiler
+{
+    public:
+        /*!
+         * \brief Returns true, when the registration is currently profiled.
+         */
+        static bool is_enabled() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Enables or disables the profiling; e.g. for a registration which is executed after startup.
+         */
+        static void set_enabled(bool enabled) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns all records in the order the scopes were started.
+         */
+        static std::vector<registration_profile_record> get_records();
+
+        /*!
+         * \brief Returns all records as JSON document.
+         *
+         * \code{.json}
+         *   { "records": [ { "kind": "block", "name": "main.cpp:12", "parent": -1, "nanoseconds": 15230,
+         *                    "types": 4, "items": 3, "allocated_bytes": 640 }, ... ] }
+         * \endcode
+         */
+        static std::string get_report();
+
+        /*!
+         * \brief Removes all records.
+         */
+        static void clear();
+};
+
+} // end namespace rttr
+
+#endif // RTTR_REGISTRATION_PROFILER_H_
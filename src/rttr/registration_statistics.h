@@ -0,0 +1,126 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_REGISTRATION_STATISTICS_H_
+#define RTTR_REGISTRATION_STATISTICS_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/type.h"
+
+#include <vector>
+#include <cstddef>
+
+namespace rttr
+{
+
+/*!
+ * The \ref memory_usage struct holds the number of bytes, which are used by the registered reflection information,
+ * split up into categories.
+ *
+ * The byte counts are the size of the objects created by RTTR plus the heap memory owned by these objects.
+ * The overhead of the heap allocator itself is not included.
+ */
+struct RTTR_API memory_usage
+{
+    memory_usage() RTTR_NOEXCEPT
+    :   types(0), properties(0), methods(0), constructors(0), enumerations(0), metadata(0), names(0)
+    {}
+
+    //! The type data and class data (base classes, derived classes, conversion functions, ...) of the types.
+    std::size_t types;
+    //! The property wrappers and the property lists of the classes.
+    std::size_t properties;
+    //! The method wrappers, their signature strings and the method lists of the classes.
+    std::size_t methods;
+    //! The constructor and destructor wrappers and the constructor lists of the classes.
+    std::size_t constructors;
+    //! The enumeration wrappers, including their name and value indices.
+    std::size_t enumerations;
+    //! The metadata entries of types and items.
+    std::size_t metadata;
+    //! The type names, the name lookup tables and the name lists of the classes.
+    std::size_t names;
+
+    /*!
+     * \brief Returns the sum of all categories.
+     */
+    std::size_t get_total() const RTTR_NOEXCEPT
+    {
+        return (types + properties + methods + constructors + enumerations + metadata + names);
+    }
+
+    /*!
+     * \brief Adds the byte counts of \p other to this object.
+     */
+    memory_usage& operator+=(const memory_usage& other) RTTR_NOEXCEPT
+    {
+        types           += other.types;
+        properties      += other.properties;
+        methods         += other.methods;
+        constructors    += other.constructors;
+        enumerations    += other.enumerations;
+        metadata        += other.metadata;
+        names           += other.names;
+        return *this;
+    }
+};
+
+/*!
+ * The \ref type_memory_usage struct holds the memory usage for one registered type.
+ */
+struct RTTR_API type_memory_usage
+{
+    type_memory_usage(type t) RTTR_NOEXCEPT : registered_type(t) {}
+
+    //! The type, the memory is used for.
+    type            registered_type;
+    //! The memory usage of the type and all its members.
+    memory_usage    usage;
+};
+
+/*!
+ * The \ref registration_statistics struct is a snapshot of the memory,
+ * which is used by all registered reflection information.
+ *
+ * The memory of a property, method or constructor is accounted to its declaring type.
+ * Global items and the tables which are shared by all types (e.g. the lookup from a name to a type)
+ * are only part of the \ref total.
+ *
+ * \see registration::get_statistics()
+ */
+struct RTTR_API registration_statistics
+{
+    //! The memory usage of all reflection information.
+    memory_usage                    total;
+    //! The memory usage per type; sorted in descending order of \ref memory_usage::get_total().
+    std::vector<type_memory_usage>  type_list;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_REGISTRATION_STATISTICS_H_
@@ -36,15 +36,22 @@ set(HEADER_FILES access_levels.h
                  enum_flags.h
                  filter_item.h
                  instance.h
+                 interned_string.h
+                 hashed_name.h
+                 hot_path_counters.h
                  method.h
                  policy.h
                  property.h
                  parameter_info.h
                  registration
                  registration.h
+                 registration_statistics.h
+                 registration_profiler.h
                  string_view.h
                  rttr_cast.h
                  rttr_enable.h
+                 sorted_vector_map.h
+                 sorted_vector_set.h
                  type
                  type.h
                  variant.h
@@ -53,11 +60,13 @@ set(HEADER_FILES access_levels.h
                  wrapper_mapper.h
                  detail/array/array_accessor.h
                  detail/array/array_accessor_impl.h
+                 detail/array/array_index_list.h
                  detail/array/array_mapper_impl.h
                  detail/array/array_wrapper.h
                  detail/array/array_wrapper_base.h
                  detail/base/core_prerequisites.h
                  detail/base/version.h.in
+                 detail/base/build_config.h.in
                  detail/base/version.rc.in
                  detail/comparison/comparable_types.h
                  detail/comparison/compare_array_less.h
@@ -74,6 +83,7 @@ set(HEADER_FILES access_levels.h
                  detail/constructor/constructor_wrapper_base.h
                  detail/conversion/std_conversion_functions.h
                  detail/conversion/number_conversion.h
+                 detail/conversion/conversion_kind.h
                  detail/default_arguments/default_arguments.h
                  detail/default_arguments/invoke_with_defaults.h
                  detail/destructor/destructor_wrapper.h
@@ -83,12 +93,15 @@ set(HEADER_FILES access_levels.h
                  detail/enumeration/enumeration_wrapper_base.h
                  detail/enumeration/enum_data.h
                  detail/filter/filter_item_funcs.h
+                 detail/filter/filtered_item_list.h
                  detail/impl/argument_impl.h
                  detail/impl/array_range_impl.h
                  detail/impl/associative_mapper_impl.h
                  detail/impl/enum_flags_impl.h
                  detail/impl/instance_impl.h
+                 detail/impl/interned_string_impl.h
                  detail/impl/rttr_cast_impl.h
+                 detail/impl/sorted_vector_map_impl.h
                  detail/impl/string_view_impl.h
                  detail/impl/wrapper_mapper_impl.h
                  detail/metadata/metadata.h
@@ -101,11 +114,12 @@ set(HEADER_FILES access_levels.h
                  detail/misc/argument_extractor.h
                  detail/misc/class_item_mapper.h
                  detail/misc/data_address_container.h
-                 detail/misc/flat_map.h
-                 detail/misc/flat_multimap.h
+                 detail/misc/flat_hash_map.h
                  detail/misc/function_traits.h
+                 detail/misc/hot_path_counter.h
 				 detail/misc/iterator_wrapper.h
                  detail/misc/misc_type_traits.h
+                 detail/misc/sorted_vector_base.h
                  detail/misc/std_type_traits.h
                  detail/misc/utility.h
                  detail/parameter_info/parameter_infos.h
@@ -128,6 +142,7 @@ set(HEADER_FILES access_levels.h
                  detail/registration/register_base_class_from_accessor.h
                  detail/registration/registration_impl.h
                  detail/registration/registration_executer.h
+                 detail/registration/registration_profile_scope.h
                  detail/type/accessor_type.h
                  detail/type/base_classes.h
                  detail/type/get_create_variant_func.h
@@ -141,6 +156,7 @@ set(HEADER_FILES access_levels.h
                  detail/type/type_register_p.h
                  detail/type/type_string_utils.h
                  detail/variant/variant_compare.h
+                 detail/variant/variant_conversion_matrix.h
                  detail/variant/variant_data.h
                  detail/variant/variant_data_converter.h
                  detail/variant/variant_data_policy.h
@@ -150,6 +166,7 @@ set(HEADER_FILES access_levels.h
                  detail/variant_array_view/variant_array_view_creator_impl.h
                  detail/variant_array_view/variant_array_view_traits.h
                  detail/variant_associative_view/variant_associative_view_p.h
+                 detail/variant_associative_view/variant_associative_view_impl.h
                  detail/variant_associative_view/variant_associative_view_creator.h
                  detail/variant_associative_view/variant_associative_view_creator_impl.h
                 )
@@ -157,11 +174,14 @@ set(HEADER_FILES access_levels.h
 set(SOURCE_FILES constructor.cpp
                  destructor.cpp
                  enumeration.cpp
+                 hot_path_counters.cpp
+                 interned_string.cpp
                  method.cpp
                  parameter_info.cpp
                  policy.cpp
                  property.cpp
                  registration.cpp
+                 registration_profiler.cpp
                  type.cpp
                  variant.cpp
                  variant_array_view.cpp
@@ -180,4 +200,5 @@ set(SOURCE_FILES constructor.cpp
                  detail/registration/registration_executer.cpp
                  detail/type/type_register.cpp
                  detail/variant/variant_compare.cpp
+                 detail/variant/variant_conversion_matrix.cpp
                  )
@@ -0,0 +1,120 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_SORTED_VECTOR_MAP_H_
+#define RTTR_SORTED_VECTOR_MAP_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/sorted_vector_base.h"
+
+namespace rttr
+{
+namespace detail
+{
+template<typename Key, typename T>
+struct sorted_vector_map_key
+{
+    static RTTR_INLINE const Key& get(const std::pair<Key, T>& value) { return value.first; }
+};
+} // end namespace detail
+
+/*!
+ * The \ref sorted_vector_map class is an associative container, which stores its key-value pairs
+ * sorted by key in one contiguous `std::vector`.
+ *
+ * Compared to `std::map`, a lookup is a binary search over contiguous memory, which makes it cache friendly;
+ * inserting or removing a single element has linear complexity.
+ * Therefore this container is meant for lookup tables, which are filled once (use the bulk insert functions)
+ * and read often.
+ *
+ * The \ref sorted_vector_map can be used with a \ref variant_associative_view.
+ * In order to access the elements as an array, create a \ref variant_array_view from the result of values():
+ *
+ * \code{.cpp}
+ *  sorted_vector_map<int, std::string> map = { { 1, "one" }, { 2, "two" } };
+ *
+ *  variant var = std::ref(map);
+ *  auto assoc_view = var.create_associative_view();        // find(), equal_range() ...
+ *
+ *  variant var_values = std::cref(map.values());
+ *  auto array_view = var_values.create_array_view();       // read-only, contiguous data
+ * \endcode
+ *
+ * \remark The key of an element must not be modified through an iterator, otherwise the ordering will be broken.
+ *         When \p Compare is transparent (e.g. `std::less<>`), find(), count() and equal_range() accept
+ *         every type, which can be compared with \p Key.
+ */
+template<typename Key, typename T, typename Compare = std::less<Key>>
+class sorted_vector_map : public detail::sorted_vector_base<Key, std::pair<Key, T>, detail::sorted_vector_map_key<Key, T>, Compare, false>
+{
+    using base_class = detail::sorted_vector_base<Key, std::pair<Key, T>, detail::sorted_vector_map_key<Key, T>, Compare, false>;
+
+    public:
+        using mapped_type = T;
+
+        /*!
+         * \brief Constructs an empty container.
+         */
+        sorted_vector_map();
+
+        /*!
+         * \brief Constructs an empty container, which uses \p comp to order its keys.
+         */
+        explicit sorted_vector_map(const Compare& comp);
+
+        /*!
+         * \brief Constructs the container with the elements of the range [\p first, \p last).
+         *        For equal keys, only the first element is inserted.
+         */
+        template<typename Itr>
+        sorted_vector_map(Itr first, Itr last, const Compare& comp = Compare());
+
+        /*!
+         * \brief Constructs the container with the elements of the range [\p first, \p last),
+         *        which must be already sorted and unique. The elements are copied without any comparison.
+         */
+        template<typename Itr>
+        sorted_vector_map(sorted_unique_t, Itr first, Itr last, const Compare& comp = Compare());
+
+        /*!
+         * \brief Constructs the container with the elements of the initializer list \p list.
+         */
+        sorted_vector_map(std::initializer_list<std::pair<Key, T>> list, const Compare& comp = Compare());
+
+        /*!
+         * \brief Returns a reference to the mapped value of the element with key \p key,
+         *        when no such element exists, a default constructed value will be inserted.
+         */
+        T& operator[](const Key& key);
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/sorted_vector_map_impl.h"
+
+#endif // RTTR_SORTED_VECTOR_MAP_H_
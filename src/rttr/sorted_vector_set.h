@@ -0,0 +1,94 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_SORTED_VECTOR_SET_H_
+#define RTTR_SORTED_VECTOR_SET_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/sorted_vector_base.h"
+
+namespace rttr
+{
+namespace detail
+{
+template<typename Key>
+struct sorted_vector_set_key
+{
+    static RTTR_INLINE const Key& get(const Key& value) { return value; }
+};
+} // end namespace detail
+
+/*!
+ * The \ref sorted_vector_set class is an associative container, which stores its unique keys
+ * sorted in one contiguous `std::vector`.
+ *
+ * It is the set counterpart of \ref sorted_vector_map; a lookup is a binary search over contiguous memory,
+ * inserting or removing a single element has linear complexity.
+ * The elements cannot be modified through an iterator.
+ *
+ * The \ref sorted_vector_set can be used with a \ref variant_associative_view.
+ * In order to access the elements as an array, create a \ref variant_array_view from the result of values().
+ */
+template<typename Key, typename Compare = std::less<Key>>
+class sorted_vector_set : public detail::sorted_vector_base<Key, Key, detail::sorted_vector_set_key<Key>, Compare, true>
+{
+    using base_class = detail::sorted_vector_base<Key, Key, detail::sorted_vector_set_key<Key>, Compare, true>;
+
+    public:
+        /*!
+         * \brief Constructs an empty container.
+         */
+        sorted_vector_set() {}
+
+        /*!
+         * \brief Constructs an empty container, which uses \p comp to order its keys.
+         */
+        explicit sorted_vector_set(const Compare& comp) : base_class(comp) {}
+
+        /*!
+         * \brief Constructs the container with the elements of the range [\p first, \p last).
+         */
+        template<typename Itr>
+        sorted_vector_set(Itr first, Itr last, const Compare& comp = Compare()) : base_class(first, last, comp) {}
+
+        /*!
+         * \brief Constructs the container with the elements of the range [\p first, \p last),
+         *        which must be already sorted and unique. The elements are copied without any comparison.
+         */
+        template<typename Itr>
+        sorted_vector_set(sorted_unique_t tag, Itr first, Itr last, const Compare& comp = Compare()) : base_class(tag, first, last, comp) {}
+
+        /*!
+         * \brief Constructs the container with the elements of the initializer list \p list.
+         */
+        sorted_vector_set(std::initializer_list<Key> list, const Compare& comp = Compare()) : base_class(list, comp) {}
+};
+
+} // end namespace rttr
+
+#endif // RTTR_SORTED_VECTOR_SET_H_
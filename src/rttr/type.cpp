@@ -41,7 +41,6 @@
 #include "rttr/rttr_enable.h"
 
 #include "rttr/detail/parameter_info/parameter_infos_compare.h"
-#include "rttr/detail/filter/filter_item_funcs.h"
 #include "rttr/detail/type/type_register_p.h"
 
 #include <algorithm>
@@ -170,6 +169,13 @@ variant type::get_metadata(const variant& key) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant type::get_metadata(const interned_string& key) const
+{
+    return detail::type_register_private::get_metadata(*this, key);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant type::create(vector<argument> args) const
 {
     auto& ctors = m_type_data->get_class_data().m_ctors;
@@ -207,6 +213,34 @@ property type::get_property(string_view name) const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+property type::get_property(const symbol& name) const RTTR_NOEXCEPT
+{
+    const auto& class_data = get_raw_type().m_type_data->get_class_data();
+    const auto& names = class_data.m_property_names;
+    const auto ret = std::find(names.cbegin(), names.cend(), name);
+    if (ret != names.cend())
+        return class_data.m_properties[std::distance(names.cbegin(), ret)];
+
+    return detail::create_invalid_item<property>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+property type::get_property(const hashed_name& name) const RTTR_NOEXCEPT
+{
+    const auto& class_data = get_raw_type().m_type_data->get_class_data();
+    const auto& names = class_data.m_property_names;
+    for (std::size_t index = 0; index < names.size(); ++index)
+    {
+        if (names[index].get_hash() == name.get_hash() && names[index].str() == name.str())
+            return class_data.m_properties[index];
+    }
+
+    return detail::create_invalid_item<property>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant type::get_property_value(string_view name, instance obj) const
 {
     return get_property(name).get_value(obj);
@@ -240,29 +274,16 @@ bool type::set_property_value(string_view name, argument arg)
 
 array_range<property> type::get_properties() const RTTR_NOEXCEPT
 {
-    auto& vec = get_raw_type().m_type_data->get_class_data().m_properties;
-    if (!vec.empty())
-    {
-        return array_range<property>(vec.data(), vec.size(),
-                                     detail::default_predicate<property>([](const property& prop)
-                                     {
-                                         return (prop.get_access_level() == access_levels::public_access);
-                                     }) );
-    }
-
-    return array_range<property>();
+    return get_raw_type().m_type_data->get_class_data().m_filtered_properties.get_items(filter_item::instance_item |
+                                                                                        filter_item::static_item |
+                                                                                        filter_item::public_access);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 array_range<property> type::get_properties(filter_items filter) const RTTR_NOEXCEPT
 {
-    const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->get_class_data().m_properties;
-    if (!vec.empty())
-        return array_range<property>(vec.data(), vec.size(), detail::get_filter_predicate<property>(raw_t, filter));
-
-    return array_range<property>();
+    return get_raw_type().m_type_data->get_class_data().m_filtered_properties.get_items(filter);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +305,34 @@ method type::get_method(string_view name) const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+method type::get_method(const symbol& name) const RTTR_NOEXCEPT
+{
+    const auto& class_data = get_raw_type().m_type_data->get_class_data();
+    const auto& names = class_data.m_method_names;
+    const auto ret = std::find(names.cbegin(), names.cend(), name);
+    if (ret != names.cend())
+        return class_data.m_methods[std::distance(names.cbegin(), ret)];
+
+    return detail::create_invalid_item<method>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+method type::get_method(const hashed_name& name) const RTTR_NOEXCEPT
+{
+    const auto& class_data = get_raw_type().m_type_data->get_class_data();
+    const auto& names = class_data.m_method_names;
+    for (std::size_t index = 0; index < names.size(); ++index)
+    {
+        if (names[index].get_hash() == name.get_hash() && names[index].str() == name.str())
+            return class_data.m_methods[index];
+    }
+
+    return detail::create_invalid_item<method>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 method type::get_method(string_view name, const std::vector<type>& type_list) const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
@@ -303,30 +352,16 @@ method type::get_method(string_view name, const std::vector<type>& type_list) co
 
 array_range<method> type::get_methods() const RTTR_NOEXCEPT
 {
-    const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->get_class_data().m_methods;
-    if (!vec.empty())
-    {
-        return array_range<method>(vec.data(), vec.size(),
-                                   detail::default_predicate<method>([](const method& meth)
-                                   {
-                                        return (meth.get_access_level() == access_levels::public_access);
-                                   }) );
-    }
-
-    return array_range<method>();
+    return get_raw_type().m_type_data->get_class_data().m_filtered_methods.get_items(filter_item::instance_item |
+                                                                                     filter_item::static_item |
+                                                                                     filter_item::public_access);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 array_range<method> type::get_methods(filter_items filter) const RTTR_NOEXCEPT
 {
-    const auto raw_t = get_raw_type();
-    auto& vec = raw_t.m_type_data->get_class_data().m_methods;
-    if (!vec.empty())
-        return array_range<method>(vec.data(), vec.size(), detail::get_filter_predicate<method>(raw_t, filter));
-
-    return array_range<method>();
+    return get_raw_type().m_type_data->get_class_data().m_filtered_methods.get_items(filter);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -358,17 +393,11 @@ method type::get_global_method(string_view name) RTTR_NOEXCEPT
 method type::get_global_method(string_view name, const std::vector<type>& type_list) RTTR_NOEXCEPT
 {
     auto& meth_list = detail::type_register_private::get_global_method_storage();
-    auto itr = meth_list.find(name);
-    while (itr != meth_list.end())
+    for (auto itr = meth_list.find(name); itr != meth_list.end(); itr = meth_list.find_next(itr))
     {
         const auto& meth = *itr;
-        if (meth.get_name() != name)
-            break;
-
         if (detail::compare_with_type_list::compare(meth.get_parameter_infos(), type_list))
             return meth;
-
-        ++itr;
     }
 
     return detail::create_invalid_item<method>();
@@ -419,19 +448,13 @@ variant type::invoke(string_view name, instance obj, std::vector<argument> args)
 variant type::invoke(string_view name, std::vector<argument> args)
 {
     auto& meth_list = detail::type_register_private::get_global_method_storage();
-    auto itr = meth_list.find(name);
-    while (itr != meth_list.end())
+    for (auto itr = meth_list.find(name); itr != meth_list.end(); itr = meth_list.find_next(itr))
     {
         const auto& meth = *itr;
-        if (meth.get_name() != name)
-            break;
-
         if (detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
         {
             return meth.invoke_variadic(instance(), args);
         }
-
-        ++itr;
     }
 
     return variant();
@@ -451,6 +474,30 @@ type type::get_by_name(string_view name) RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+type type::get_by_name(const symbol& name) RTTR_NOEXCEPT
+{
+    auto& custom_name_to_id = detail::type_register_private::get_custom_name_to_id();
+    auto ret = custom_name_to_id.find(name.str(), name.get_hash());
+    if (ret != custom_name_to_id.end())
+        return (*ret);
+
+    return detail::get_invalid_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type type::get_by_name(const hashed_name& name) RTTR_NOEXCEPT
+{
+    auto& custom_name_to_id = detail::type_register_private::get_custom_name_to_id();
+    auto ret = custom_name_to_id.find(name.str(), name.get_hash());
+    if (ret != custom_name_to_id.end())
+        return (*ret);
+
+    return detail::get_invalid_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 const detail::type_converter_base* type::get_type_converter(const type& target_type) const RTTR_NOEXCEPT
 {
     return detail::type_register_private::get_converter(*this, target_type);
@@ -474,28 +521,16 @@ constructor type::get_constructor(const std::vector<type>& args) const RTTR_NOEX
 
 array_range<constructor> type::get_constructors() const RTTR_NOEXCEPT
 {
-    auto& ctors = m_type_data->get_class_data().m_ctors;
-    if (!ctors.empty())
-    {
-        return array_range<constructor>(ctors.data(), ctors.size(),
-                                        detail::default_predicate<constructor>([](const constructor& ctor)
-                                        {
-                                            return (ctor.get_access_level() == access_levels::public_access);
-                                        }) );
-    }
-
-    return array_range<constructor>();
+    return m_type_data->get_class_data().m_filtered_ctors.get_items(filter_item::instance_item |
+                                                                    filter_item::static_item |
+                                                                    filter_item::public_access);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 array_range<constructor> type::get_constructors(filter_items filter) const RTTR_NOEXCEPT
 {
-    auto& ctors = m_type_data->get_class_data().m_ctors;
-    if (!ctors.empty())
-        return array_range<constructor>(ctors.data(), ctors.size(), detail::get_filter_predicate<constructor>(*this, filter));
-
-    return array_range<constructor>();
+    return m_type_data->get_class_data().m_filtered_ctors.get_items(filter);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,8 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/string_view.h"
+#include "rttr/interned_string.h"
+#include "rttr/hashed_name.h"
 #include "rttr/array_range.h"
 #include "rttr/filter_item.h"
 
@@ -321,6 +323,38 @@ class RTTR_API type
          */
         static type get_by_name(string_view name) RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns the type object with the given \p name.
+         *
+         * The hash value of the \ref symbol is reused, so the name does not need to be hashed again.
+         *
+         * \return \ref type object with the name \p name.
+         *
+         * \see get_by_name(string_view)
+         */
+        static type get_by_name(const symbol& name) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the type object with the given \p name.
+         *
+         * The precomputed hash value of the \ref hashed_name is used, so the name does not need to be hashed again.
+         *
+         * \return \ref type object with the name \p name.
+         *
+         * \see get_by_name(string_view)
+         */
+        static type get_by_name(const hashed_name& name) RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the type object with the given string literal \p name.
+         *
+         * The name is forwarded as \ref hashed_name, so the hash value can be calculated at compile time.
+         *
+         * \return \ref type object with the name \p name.
+         */
+        template<std::size_t N>
+        static type get_by_name(const char (&name)[N]) RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered type objects.
          *
@@ -502,6 +536,20 @@ class RTTR_API type
          */
         variant get_metadata(const variant& key) const;
 
+        /*!
+         * \brief Returns the meta data for the given interned \p key.
+         *
+         * Use this overload for keys which are queried very often, e.g. `static const interned_string key("NO_SERIALIZE");`.
+         * The key is compared by its identity, so no \ref variant is created and no string is compared.
+         *
+         * \remark Only meta data registered with a string key can be found with this function.
+         *         When no meta data is registered with the given \p key,
+         *         an invalid \ref variant object is returned (see \ref variant::is_valid).
+         *
+         * \return A variant object, containing arbitrary data.
+         */
+        variant get_metadata(const interned_string& key) const;
+
         /*!
          * \brief Returns a public constructor whose parameters match the types in the specified list.
          *
@@ -614,6 +662,28 @@ class RTTR_API type
          */
         property get_property(string_view name) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a property with the name \p name.
+         *
+         * The names are compared by the identity of the \ref symbol, without comparing any characters.
+         *
+         * \remark When there exists no property with the name \p name, then an invalid property is returned.
+         *
+         * \return A property with name \p name.
+         */
+        property get_property(const symbol& name) const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns a property with the name \p name.
+         *
+         * The precomputed hash value is compared first, the characters only when the hash values are equal.
+         *
+         * \remark When there exists no property with the name \p name, then an invalid property is returned.
+         *
+         * \return A property with name \p name.
+         */
+        property get_property(const hashed_name& name) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a range of all registered *public* properties for this type and
          *        all its base classes.
@@ -744,6 +814,28 @@ class RTTR_API type
          */
         method get_method(string_view name) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns a method with the name \p name.
+         *
+         * The names are compared by the identity of the \ref symbol, without comparing any characters.
+         *
+         * \remark When there exists no method with the name \p name, then an invalid method is returned.
+         *
+         * \return A method with name \p name.
+         */
+        method get_method(const symbol& name) const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns a method with the name \p name.
+         *
+         * The precomputed hash value is compared first, the characters only when the hash values are equal.
+         *
+         * \remark When there exists no method with the name \p name, then an invalid method is returned.
+         *
+         * \return A method with name \p name.
+         */
+        method get_method(const hashed_name& name) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns a method with the name \p name which match the given parameter type list \p type_list.
          *
@@ -28,9 +28,12 @@
 #include "rttr/variant.h"
 
 #include "rttr/detail/variant/variant_data_policy.h"
+#include "rttr/detail/variant/variant_conversion_matrix.h"
 #include "rttr/variant_array_view.h"
 #include "rttr/variant_associative_view.h"
 #include "rttr/argument.h"
+#include "rttr/enumeration.h"
+#include "rttr/detail/misc/hot_path_counter.h"
 
 #include <algorithm>
 #include <limits>
@@ -101,6 +104,13 @@ variant& variant::operator=(const variant& other)
     if (this == &other)
         return *this;
 
+    // same type: assign the value directly, this will reuse already allocated memory
+    if (m_policy == other.m_policy &&
+        other.m_policy(detail::variant_policy_operation::ASSIGN, other.m_data, m_data))
+    {
+        return *this;
+    }
+
     m_policy(detail::variant_policy_operation::DESTROY, m_data, detail::argument_wrapper());
     other.m_policy(detail::variant_policy_operation::CLONE, other.m_data, m_data);
     m_policy = other.m_policy;
@@ -193,7 +203,7 @@ variant variant::extract_wrapped_value() const
 variant_array_view variant::create_array_view() const
 {
     variant_array_view result;
-    m_policy(detail::variant_policy_operation::TO_ARRAY, m_data, result.m_array_wrapper);
+    m_policy(detail::variant_policy_operation::TO_ARRAY, m_data, result.m_array_wrapper_storage);
     return result;
 }
 
@@ -219,6 +229,9 @@ bool variant::can_convert(const type& target_type) const
     if (source_type == target_type)
         return true;
 
+    if (detail::get_basic_conversion_func(source_type.m_type_data->conv_kind, target_type.m_type_data->conv_kind))
+        return true;
+
     if (source_type.get_pointer_dimension() == 1 && target_type.get_pointer_dimension() == 1)
     {
         if (void * ptr = type::apply_offset(get_raw_ptr(), source_type, target_type))
@@ -234,14 +247,15 @@ bool variant::can_convert(const type& target_type) const
     const bool source_is_arithmetic = source_type.is_arithmetic();
     const bool target_is_arithmetic = target_type.is_arithmetic();
     const bool target_is_enumeration = target_type.is_enumeration();
+    const bool source_is_string = detail::is_string_conversion_kind(source_type.m_type_data->conv_kind);
     const type string_type = type::get<std::string>();
 
     return ((source_is_arithmetic && target_is_arithmetic) ||
             (source_is_arithmetic && target_type == string_type) ||
-            (source_type == string_type && target_is_arithmetic) ||
+            (source_is_string && target_is_arithmetic) ||
             (source_type.is_enumeration() && target_is_arithmetic) ||
             (source_is_arithmetic && target_is_enumeration) ||
-            (source_type == string_type && target_is_enumeration));
+            (source_is_string && target_is_enumeration));
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -254,15 +268,22 @@ bool variant::convert(const type& target_type, variant& target_var) const
     bool ok = false;
 
     const type source_type = get_type();
-    const bool source_is_arithmetic = source_type.is_arithmetic();
-    const bool target_is_arithmetic = target_type.is_arithmetic();
-    const type string_type = type::get<std::string>();
+    RTTR_COUNT_HOT_PATH(counter_kind::variant_convert, (static_cast<std::uintptr_t>(source_type.get_id()) << 16) | target_type.get_id());
     if (target_type == source_type)
     {
         target_var = *this;
         return true; // the current variant is already the target type, we don't need to do anything
     }
-    else if (source_type.is_wrapper() && !target_type.is_wrapper())
+
+    // all built-in conversions between arithmetic types, enums and std::string are resolved with one table lookup
+    if (const auto convert_func = detail::get_basic_conversion_func(source_type.m_type_data->conv_kind, target_type.m_type_data->conv_kind))
+        return convert_func(get_ptr(), target_var);
+
+    const bool source_is_arithmetic = source_type.is_arithmetic();
+    const bool target_is_arithmetic = target_type.is_arithmetic();
+    const type string_type = type::get<std::string>();
+    const type interned_string_type = type::get<interned_string>();
+    if (source_type.is_wrapper() && !target_type.is_wrapper())
     {
         variant var = extract_wrapped_value();
         ok = var.convert(target_type);
@@ -272,7 +293,7 @@ bool variant::convert(const type& target_type, variant& target_var) const
             (source_is_arithmetic && target_type == string_type) ||
             (source_type == string_type && target_is_arithmetic) ||
             (source_type.is_enumeration() && target_is_arithmetic) ||
-            (source_type.is_enumeration() && target_type == string_type))
+            (source_type.is_enumeration() && (target_type == string_type || target_type == interned_string_type)))
     {
         if (target_type == type::get<bool>())
         {
@@ -352,8 +373,14 @@ bool variant::convert(const type& target_type, variant& target_var) const
             if ((ok = try_basic_type_conversion(value)))
                 target_var = std::move(value);
         }
+        else if (target_type == interned_string_type)
+        {
+            interned_string value;
+            if ((ok = try_basic_type_conversion(value)))
+                target_var = value;
+        }
     }
-    else if ((source_is_arithmetic || source_type == string_type)
+    else if ((source_is_arithmetic || detail::is_string_conversion_kind(source_type.m_type_data->conv_kind))
              && target_type.is_enumeration())
     {
         variant var = target_type;
@@ -400,6 +427,31 @@ bool variant::convert(const type& target_type)
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant variant::convert_from_chars(string_view text, const type& target_type)
+{
+    variant result;
+    if (!target_type.is_valid())
+        return result;
+
+    if (const auto from_chars_func = detail::get_from_chars_func(target_type.m_type_data->conv_kind))
+    {
+        from_chars_func(text, result);
+        return result;
+    }
+
+    if (target_type.is_enumeration())
+        return target_type.get_enumeration().name_to_value(text);
+
+    // custom types can only be created by a registered converter function from std::string
+    result = text.to_string();
+    if (!result.convert(target_type))
+        result.clear();
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 bool variant::to_bool() const
 {
     return convert<bool>(nullptr);
@@ -33,6 +33,7 @@
 #include "rttr/detail/variant/variant_data.h"
 #include "rttr/detail/misc/argument_wrapper.h"
 #include "rttr/detail/variant/variant_compare.h"
+#include "rttr/string_view.h"
 
 #include <type_traits>
 #include <cstddef>
@@ -65,6 +66,12 @@ namespace detail
     using decay_variant_t = enable_if_t<!std::is_same<Decayed, variant>::value &&
                                         !std::is_same<Decayed, variant_array_view>::value, Decayed>;
 
+    template<typename Tp, typename T>
+    using can_assign_in_place = std::integral_constant<bool, !std::is_array<Tp>::value &&
+                                                             !is_nullptr_t<Tp>::value &&
+                                                             !std::is_same<Tp, void_variant_type>::value &&
+                                                             std::is_assignable<Tp&, T>::value>;
+
     using variant_policy_func = bool (*)(variant_policy_operation, const variant_data&, argument_wrapper);
 }
 
@@ -225,6 +232,9 @@ class RTTR_API variant
         /*!
          * Assigns the value of the \p other object to this variant.
          *
+         * When the variant contains already a value of the same type, the value will be assigned directly
+         * to the contained value. So no memory has to be released and allocated again.
+         *
          * \return A reference to the variant with the new data.
          */
         template<typename T, typename Tp = detail::decay_variant_t<T>>
@@ -240,10 +250,31 @@ class RTTR_API variant
         /*!
          * \brief Assigns the value of the \a other variant to this variant.
          *
+         * When both variants contain a value of the same copy assignable type,
+         * the value of \p other will be assigned directly to the contained value; without releasing and allocating memory.
+         *
          * \return A reference to the variant with the new data.
          */
         variant& operator=(const variant& other);
 
+        /*!
+         * \brief Destroys the contained value and constructs a new value of type \p T in place,
+         *        by forwarding the given arguments \p args to its constructor.
+         *
+         * In contrast to an assignment, no temporary object of type \p T has to be created and copied or moved into the variant.
+         *
+         * \code{.cpp}
+         *  variant var;
+         *  std::string& text = var.emplace<std::string>(5, 'a'); // var contains "aaaaa"
+         * \endcode
+         *
+         * \remark Raw arrays cannot be constructed in place.
+         *
+         * \return A reference to the new contained value.
+         */
+        template<typename T, typename... Args>
+        T& emplace(Args&&... args);
+
         /*!
          * \brief Compares this variant with \p other and returns `true` if they are equal; otherwise returns `false`.
          *
@@ -474,6 +505,27 @@ class RTTR_API variant
          */
         bool convert(const type& target_type);
 
+        /*!
+         * \brief Parses the character sequence \p text directly into a new value of type \p target_type
+         *        and returns it inside a variant.
+         *
+         * In contrast to `variant(std::string(text)).convert(target_type)` no temporary std::string is created
+         * for arithmetic target types, which makes this function well suited for parsing slices of a bigger buffer,
+         * like tokens of a JSON or CSV document.
+         *
+         * \code{.cpp}
+         *  const char* csv = "42,3.5,true";
+         *  variant var = variant::convert_from_chars(string_view(csv, 2), type::get<int>()); // var contains 42
+         * \endcode
+         *
+         * \remark Enumeration target types are parsed via their registered names, see \ref enumeration::name_to_value().
+         *         For all other types a user-defined \ref type::register_converter_func() "conversion function"
+         *         from std::string will be used.
+         *
+         * \return A variant containing the parsed value; when the text could not be parsed, an invalid variant will be returned.
+         */
+        static variant convert_from_chars(string_view text, const type& target_type);
+
         /*!
          * \brief Converts the containing data to a *new value* of type \p T and return this *value*.
          *        If \p ok is non-null: \p *ok is set to `true` when the value was successfully converted to \p T; otherwise \p *ok is set to `false`.
@@ -883,6 +935,22 @@ class RTTR_API variant
 
         bool convert(const type& target_type, variant& var) const;
 
+        /*!
+         * \brief Assigns the given \p value directly to the contained value, when the variant contains already a value of type \p Tp.
+         *
+         * \return `True`, when the value was assigned, otherwise `false`.
+         */
+        template<typename Tp, typename T>
+        detail::enable_if_t<detail::can_assign_in_place<Tp, T>::value, bool> try_assign_in_place(T&& value);
+
+        /*!
+         * \brief A dummy method which does in fact always return `false`.
+         *
+         * \return `False`.
+         */
+        template<typename Tp, typename T>
+        detail::enable_if_t<!detail::can_assign_in_place<Tp, T>::value, bool> try_assign_in_place(T&& value);
+
         /*!
          * \brief Tries to convert the internal type to the given type \p to.
          *
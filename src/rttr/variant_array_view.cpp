@@ -39,224 +39,406 @@ namespace rttr
 
 bool variant_array_view::is_valid() const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->is_valid();
+    return get_array_wrapper()->is_valid();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant_array_view::operator bool() const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->is_valid();
+    return get_array_wrapper()->is_valid();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::is_dynamic() const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->is_dynamic();
+    return get_array_wrapper()->is_dynamic();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 size_t variant_array_view::get_rank() const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->get_rank();
+    return get_array_wrapper()->get_rank();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 type variant_array_view::get_rank_type(std::size_t index) const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->get_rank_type(index);
+    return get_array_wrapper()->get_rank_type(index);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 type variant_array_view::get_type() const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->get_type();
+    return get_array_wrapper()->get_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::is_contiguous() const RTTR_NOEXCEPT
+{
+    return get_array_wrapper()->is_contiguous();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::contiguous_data variant_array_view::get_contiguous_data() const RTTR_NOEXCEPT
+{
+    auto wrapper = get_array_wrapper();
+    if (!wrapper->is_contiguous())
+        return {nullptr, 0, 0, detail::get_invalid_type(), true};
+
+    return {wrapper->get_data(), wrapper->get_size(), wrapper->get_element_size(),
+            wrapper->get_rank_type(1), wrapper->is_read_only()};
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::size_t variant_array_view::get_size() const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->get_size();
+    return get_array_wrapper()->get_size();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::size_t variant_array_view::get_size(std::size_t index_1) const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->get_size(index_1);
+    return get_array_wrapper()->get_size(index_1);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::size_t variant_array_view::get_size(std::size_t index_1, std::size_t index_2) const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->get_size(index_1, index_2);
+    return get_array_wrapper()->get_size(index_1, index_2);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 std::size_t variant_array_view::get_size_variadic(const std::vector<std::size_t>& index_list) const RTTR_NOEXCEPT
 {
-    return m_array_wrapper->get_size_variadic(index_list);
+    return get_array_wrapper()->get_size_variadic(index_list);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_size(std::size_t new_size)
 {
-    return m_array_wrapper->set_size(new_size);
+    return get_array_wrapper()->set_size(new_size);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_size(std::size_t new_size, std::size_t index_1)
 {
-    return m_array_wrapper->set_size(new_size, index_1);
+    return get_array_wrapper()->set_size(new_size, index_1);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_size(std::size_t new_size, std::size_t index_1, std::size_t index_2)
 {
-    return m_array_wrapper->set_size(new_size, index_1, index_2);
+    return get_array_wrapper()->set_size(new_size, index_1, index_2);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_size_variadic(std::size_t new_size, const std::vector<std::size_t>& index_list)
 {
-    return m_array_wrapper->set_size_variadic(new_size, index_list);
+    return get_array_wrapper()->set_size_variadic(new_size, index_list);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::reserve(std::size_t new_capacity)
+{
+    return get_array_wrapper()->reserve(new_capacity);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::assign(array_range<argument> values)
+{
+    return get_array_wrapper()->assign(values);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::append_range(array_range<argument> values)
+{
+    return get_array_wrapper()->append_range(values);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::assign_from(const void* data, std::size_t count, const type& element_type)
+{
+    return get_array_wrapper()->assign_from(data, count, element_type);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_value(argument arg)
 {
-    return m_array_wrapper->set_value(arg);
+    return get_array_wrapper()->set_value(arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_value(std::size_t index_1, argument arg)
 {
-    return m_array_wrapper->set_value(index_1, arg);
+    return get_array_wrapper()->set_value(index_1, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_value(std::size_t index_1, std::size_t index_2, argument arg)
 {
-    return m_array_wrapper->set_value(index_1, index_2, arg);
+    return get_array_wrapper()->set_value(index_1, index_2, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_value(std::size_t index_1, std::size_t index_2, std::size_t index_3, argument arg)
 {
-    return m_array_wrapper->set_value(index_1, index_2, index_3, arg);
+    return get_array_wrapper()->set_value(index_1, index_2, index_3, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::set_value_variadic(const std::vector<std::size_t>& index_list, argument arg)
 {
-    return m_array_wrapper->set_value_variadic(index_list, arg);
+    return get_array_wrapper()->set_value_variadic(index_list, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant variant_array_view::get_value(std::size_t index_1) const
 {
-    return m_array_wrapper->get_value(index_1);
+    return get_array_wrapper()->get_value(index_1);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant variant_array_view::get_value(std::size_t index_1, std::size_t index_2) const
 {
-    return m_array_wrapper->get_value(index_1, index_2);
+    return get_array_wrapper()->get_value(index_1, index_2);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant variant_array_view::get_value(std::size_t index_1, std::size_t index_2, std::size_t index_3) const
 {
-    return m_array_wrapper->get_value(index_1, index_2, index_3);
+    return get_array_wrapper()->get_value(index_1, index_2, index_3);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant variant_array_view::get_value_variadic(const std::vector<std::size_t>& index_list) const
 {
-    return m_array_wrapper->get_value_variadic(index_list);
+    return get_array_wrapper()->get_value_variadic(index_list);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant variant_array_view::get_value_as_ref(std::size_t index_1) const
 {
-    return m_array_wrapper->get_value_as_ref(index_1);
+    return get_array_wrapper()->get_value_as_ref(index_1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_array_view::get_flat_size() const
+{
+    return get_array_wrapper()->get_flat_size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant variant_array_view::get_flat_value(std::size_t index) const
+{
+    return get_array_wrapper()->get_flat_value(index);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::set_flat_value(std::size_t index, argument arg)
+{
+    return get_array_wrapper()->set_flat_value(index, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::insert_value(std::size_t index_1, argument arg)
 {
-    return m_array_wrapper->insert_value(index_1, arg);
+    return get_array_wrapper()->insert_value(index_1, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::insert_value(std::size_t index_1, std::size_t index_2, argument arg)
 {
-    return m_array_wrapper->insert_value(index_1, index_2, arg);
+    return get_array_wrapper()->insert_value(index_1, index_2, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::insert_value(std::size_t index_1, std::size_t index_2, std::size_t index_3, argument arg)
 {
-    return m_array_wrapper->insert_value(index_1, index_2, index_3, arg);
+    return get_array_wrapper()->insert_value(index_1, index_2, index_3, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::insert_value_variadic(const std::vector<std::size_t>& index_list, argument arg)
 {
-    return m_array_wrapper->insert_value_variadic(index_list, arg);
+    return get_array_wrapper()->insert_value_variadic(index_list, arg);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::remove_value(std::size_t index_1)
 {
-    return m_array_wrapper->remove_value(index_1);
+    return get_array_wrapper()->remove_value(index_1);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::remove_value(std::size_t index_1, std::size_t index_2)
 {
-    return m_array_wrapper->remove_value(index_1, index_2);
+    return get_array_wrapper()->remove_value(index_1, index_2);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::remove_value(std::size_t index_1, std::size_t index_2, std::size_t index_3)
 {
-    return m_array_wrapper->remove_value(index_1, index_2, index_3);
+    return get_array_wrapper()->remove_value(index_1, index_2, index_3);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
 bool variant_array_view::remove_value_variadic(const std::vector<std::size_t>& index_list)
 {
-    return m_array_wrapper->remove_value_variadic(index_list);
+    return get_array_wrapper()->remove_value_variadic(index_list);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::set_value(const const_iterator& itr, argument arg)
+{
+    return get_array_wrapper()->set_value(itr.m_itr, arg);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator variant_array_view::begin() const
+{
+    const_iterator itr(get_array_wrapper());
+    get_array_wrapper()->begin(itr.m_itr);
+    return itr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator variant_array_view::end() const
+{
+    const_iterator itr(get_array_wrapper());
+    get_array_wrapper()->end(itr.m_itr);
+    return itr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator::const_iterator(const detail::array_wrapper_base* array_wrapper) RTTR_NOEXCEPT
+:   m_array_wrapper(array_wrapper)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator::~const_iterator()
+{
+    m_array_wrapper->destroy(m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator::const_iterator(const const_iterator &other)
+:   m_array_wrapper(other.m_array_wrapper),
+    m_itr(other.m_itr)
+{
+    m_array_wrapper->copy(m_itr, other.m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator& variant_array_view::const_iterator::operator=(const_iterator other)
+{
+    swap(other);
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void variant_array_view::const_iterator::swap(const_iterator& other)
+{
+    std::swap(m_itr, other.m_itr);
+    std::swap(m_array_wrapper, other.m_array_wrapper);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const variant variant_array_view::const_iterator::operator*() const
+{
+    return m_array_wrapper->get_value(m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const variant variant_array_view::const_iterator::get_value() const
+{
+    return m_array_wrapper->get_value(m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator& variant_array_view::const_iterator::operator++()
+{
+    m_array_wrapper->advance(m_itr);
+    return *this;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant_array_view::const_iterator variant_array_view::const_iterator::operator++(int)
+{
+    const_iterator result(m_array_wrapper);
+
+    m_array_wrapper->copy(result.m_itr, m_itr);
+    m_array_wrapper->advance(m_itr);
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::const_iterator::operator==(const const_iterator& other) const
+{
+    return m_array_wrapper->equal(m_itr, other.m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_array_view::const_iterator::operator!=(const const_iterator& other) const
+{
+    return !m_array_wrapper->equal(m_itr, other.m_itr);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -31,10 +31,12 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/variant.h"
+#include "rttr/array_range.h"
+#include "rttr/detail/array/array_wrapper_base.h"
 
 #include <cstddef>
 #include <vector>
-#include <memory>
+#include <array>
 
 namespace rttr
 {
@@ -43,11 +45,6 @@ namespace rttr
     class instance;
     class argument;
 
-namespace detail
-{
-    class array_wrapper_base;
-}
-
 /*!
  * The \ref variant_array_view describes a class that refers to an array inside a \ref variant.
  * With an instance of that class you can set/get values of an array,
@@ -137,6 +134,25 @@ namespace detail
 class RTTR_API variant_array_view
 {
     public:
+        /*!
+         * \brief Describes the raw memory block of a contiguous array.
+         *
+         * \see get_contiguous_data()
+         */
+        struct contiguous_data
+        {
+            //! The address of the first element; `nullptr` when the array is not contiguous or has no storage.
+            void*       data;
+            //! The number of elements in the first dimension.
+            std::size_t size;
+            //! The size in bytes of one element, this is also the stride between two elements.
+            std::size_t element_size;
+            //! The \ref type of one element.
+            type        element_type;
+            //! True when the array is const, then the memory at \p data must not be modified.
+            bool        is_read_only;
+        };
+
         /*!
          * \brief Constructs an invalid variant_array_view object.
          *
@@ -237,6 +253,42 @@ class RTTR_API variant_array_view
          */
         type get_type() const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns true, when all elements of the first dimension are stored in one contiguous
+         *        block of memory; otherwise false.
+         *
+         * This is the case for `T[N]`, `std::array<T, N>` and `std::vector<T>` (except `std::vector<bool>`).
+         *
+         * \see get_contiguous_data()
+         */
+        bool is_contiguous() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the raw memory block of the array, when it is \ref is_contiguous() "contiguous".
+         *
+         * This makes it possible to process all elements at once, without boxing every single element into a \ref variant:
+         * \code{.cpp}
+         *  std::vector<float> vec = {1.0f, 2.0f, 3.0f};
+         *  variant var = std::ref(vec);
+         *  auto data = var.create_array_view().get_contiguous_data();
+         *  if (data.data && data.element_type == type::get<float>())
+         *  {
+         *      const float* values = static_cast<const float*>(data.data);
+         *      float sum = std::accumulate(values, values + data.size, 0.0f);
+         *  }
+         * \endcode
+         *
+         * For multi-dimensional arrays, the element is the sub array of the first dimension,
+         * e.g. for `int[4][16]` the \ref contiguous_data::element_type "element_type" is `int[16]`.
+         *
+         * \remark When the array is not contiguous, \ref contiguous_data::data "data" is `nullptr`,
+         *         the size is zero and the element type is invalid.
+         *         The returned pointer is invalidated by every operation which changes the size of the array.
+         *
+         * \return The address, element count, element size and element type of the array.
+         */
+        contiguous_data get_contiguous_data() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns the size of the first dimension from the array.
          *
@@ -268,6 +320,17 @@ class RTTR_API variant_array_view
          */
         std::size_t get_size_variadic(const std::vector<std::size_t>& index_list) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Same as \ref get_size_variadic(const std::vector<std::size_t>&) "get_size_variadic()", but with a fixed number of indices,
+         *        which avoids any heap allocation for the index list.
+         *
+         * \code{.cpp}
+         *  array.get_size_variadic(std::array<std::size_t, 3>{{0, 1, 2}});
+         * \endcode
+         */
+        template<std::size_t N>
+        std::size_t get_size_variadic(const std::array<std::size_t, N>& index_list) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Sets the size of the array at the first dimension to \p new_size.
          *
@@ -300,6 +363,85 @@ class RTTR_API variant_array_view
          */
         bool set_size_variadic(std::size_t new_size, const std::vector<std::size_t>& index_list);
 
+        /*!
+         * \brief Same as \ref set_size_variadic(const std::vector<std::size_t>&) "set_size_variadic()", but with a fixed number of indices,
+         *        which avoids any heap allocation for the index list.
+         *
+         * \code{.cpp}
+         *  array.set_size_variadic(10, std::array<std::size_t, 3>{{0, 1, 2}});
+         * \endcode
+         */
+        template<std::size_t N>
+        bool set_size_variadic(std::size_t new_size, const std::array<std::size_t, N>& index_list);
+
+        /*!
+         * \brief Increases the capacity of the array to at least \p new_capacity elements,
+         *        without changing its size.
+         *
+         * Call this function before inserting many values one by one, to avoid repeated reallocations.
+         *
+         * \remark This operation is only possible when the array type has a member function `reserve()`,
+         *         like `std::vector<T>`.
+         *
+         * \return True if the capacity could be changed, otherwise false.
+         */
+        bool reserve(std::size_t new_capacity);
+
+        /*!
+         * \brief Replaces the content in the first dimension of the array with the given \p values.
+         *
+         * A \ref is_dynamic() "dynamic" array is resized once to the number of values, for a static array
+         * the number of values must match its size.
+         * The type of every value is checked before the array is modified, so either all values or none are set.
+         *
+         * \code{.cpp}
+         *  std::vector<int> vec;
+         *  variant var = std::ref(vec);
+         *  std::vector<variant> values = {1, 2, 3};
+         *  std::vector<argument> args(values.begin(), values.end());
+         *  var.create_array_view().assign(array_range<argument>(args.data(), args.size())); // vec == {1, 2, 3}
+         * \endcode
+         *
+         * \remark Every argument must hold exactly the type of the element.
+         *
+         * \return True if the values could be set, otherwise false.
+         */
+        bool assign(array_range<argument> values);
+
+        /*!
+         * \brief Appends the given \p values at the end of the first dimension of the array.
+         *
+         * The array is resized only once and the type of every value is checked before the array is modified.
+         *
+         * \remark This operation is only possible when the array is \ref is_dynamic() "dynamic".
+         *         Every argument must hold exactly the type of the element.
+         *
+         * \return True if the values could be appended, otherwise false.
+         */
+        bool append_range(array_range<argument> values);
+
+        /*!
+         * \brief Replaces the content in the first dimension of the array with \p count elements,
+         *        which are copied from \p data.
+         *
+         * When \p T is exactly the type of the element, the elements are copied without any boxing;
+         * for `std::vector<T>` the whole block is copied at once.
+         *
+         * \code{.cpp}
+         *  std::vector<float> vec;
+         *  variant var = std::ref(vec);
+         *  const float values[] = {1.0f, 2.0f, 3.0f};
+         *  var.create_array_view().assign_from(values, 3); // vec == {1.0f, 2.0f, 3.0f}
+         * \endcode
+         *
+         * \remark A \ref is_dynamic() "dynamic" array is resized to \p count, for a static array
+         *         \p count must match its size.
+         *
+         * \return True if the values could be copied, otherwise false.
+         */
+        template<typename T>
+        bool assign_from(const T* data, std::size_t count);
+
         /*!
          * \brief Copies the content of the the array \p arg into the underlying array.
          *
@@ -341,6 +483,33 @@ class RTTR_API variant_array_view
          */
         bool set_value_variadic(const std::vector<std::size_t>& index_list, argument arg);
 
+        /*!
+         * \brief Same as \ref set_value_variadic(const std::vector<std::size_t>&) "set_value_variadic()", but with a fixed number of indices,
+         *        which avoids any heap allocation for the index list.
+         *
+         * \code{.cpp}
+         *  array.set_value_variadic(std::array<std::size_t, 4>{{0, 1, 2, 3}}, 1.0f);
+         * \endcode
+         */
+        template<std::size_t N>
+        bool set_value_variadic(const std::array<std::size_t, N>& index_list, argument arg);
+
+        class const_iterator;
+
+        /*!
+         * \brief Set the content of the the argument \p arg into the in the first dimension of the array,
+         *        at the position the iterator \p itr points to.
+         *
+         * In contrast to \ref set_value(std::size_t, argument) "set_value(index_1, arg)", the element does not
+         * have to be searched again, which makes a complete traversal of e.g. a `std::list<T>` linear.
+         *
+         * \remark The argument must match the type of the element, otherwise it will not be set.
+         *         The iterator must have been retrieved from this array view.
+         *
+         * \return True if the value could be set, otherwise false.
+         */
+        bool set_value(const const_iterator& itr, argument arg);
+
 
         /*!
          * \brief Returns the value of the array in the first dimension at index \p index_1.
@@ -372,6 +541,17 @@ class RTTR_API variant_array_view
          */
         variant get_value_variadic(const std::vector<std::size_t>& index_list) const;
 
+        /*!
+         * \brief Same as \ref get_value_variadic(const std::vector<std::size_t>&) "get_value_variadic()", but with a fixed number of indices,
+         *        which avoids any heap allocation for the index list.
+         *
+         * \code{.cpp}
+         *  variant value = array.get_value_variadic(std::array<std::size_t, 4>{{0, 1, 2, 3}});
+         * \endcode
+         */
+        template<std::size_t N>
+        variant get_value_variadic(const std::array<std::size_t, N>& index_list) const;
+
         /*!
          * \brief Returns the value of the array in the first dimension at index \p index_1
          *        wrapped inside a std::rerference_wrapper.
@@ -391,6 +571,37 @@ class RTTR_API variant_array_view
          */
         variant get_value_as_ref(std::size_t index_1) const;
 
+        /*!
+         * \brief Returns the number of innermost elements, when the array consists only of nested
+         *        raw arrays and `std::array`'s, otherwise zero.
+         *
+         * All innermost elements of such an array are stored in one block of memory,
+         * so they can be accessed with one linear index, without walking through every dimension.
+         * E.g. for `float[4][4][16]` the flat size is `256` and the element at `[1][2][3]` has the flat index `1 * 64 + 2 * 16 + 3`.
+         *
+         * \see get_flat_value(), set_flat_value()
+         */
+        std::size_t get_flat_size() const;
+
+        /*!
+         * \brief Returns the innermost element at the linear index \p index.
+         *
+         * \remark When the array is not flat (see \ref get_flat_size()) or the index is out of range,
+         *         an invalid variant is returned.
+         *
+         * \return The value of the innermost element at the given linear index.
+         */
+        variant get_flat_value(std::size_t index) const;
+
+        /*!
+         * \brief Sets the innermost element at the linear index \p index to the given argument \p arg.
+         *
+         * \remark The argument must match the type of the innermost element.
+         *
+         * \return True if the value could be set, otherwise false.
+         */
+        bool set_flat_value(std::size_t index, argument arg);
+
 
         /*!
          * \brief Inserts the given argument \p arg into the array, in the first dimension at index \p index_1.
@@ -430,6 +641,17 @@ class RTTR_API variant_array_view
          */
         bool insert_value_variadic(const std::vector<std::size_t>& index_list, argument arg);
 
+        /*!
+         * \brief Same as \ref insert_value_variadic(const std::vector<std::size_t>&) "insert_value_variadic()", but with a fixed number of indices,
+         *        which avoids any heap allocation for the index list.
+         *
+         * \code{.cpp}
+         *  array.insert_value_variadic(std::array<std::size_t, 4>{{0, 1, 2, 3}}, 1.0f);
+         * \endcode
+         */
+        template<std::size_t N>
+        bool insert_value_variadic(const std::array<std::size_t, N>& index_list, argument arg);
+
         /*!
          * \brief Removes the value at index \p index_1 in the first dimension of the array.
          *
@@ -460,11 +682,148 @@ class RTTR_API variant_array_view
          */
         bool remove_value_variadic(const std::vector<std::size_t>& index_list);
 
+        /*!
+         * \brief Same as \ref remove_value_variadic(const std::vector<std::size_t>&) "remove_value_variadic()", but with a fixed number of indices,
+         *        which avoids any heap allocation for the index list.
+         *
+         * \code{.cpp}
+         *  array.remove_value_variadic(std::array<std::size_t, 4>{{0, 1, 2, 3}});
+         * \endcode
+         */
+        template<std::size_t N>
+        bool remove_value_variadic(const std::array<std::size_t, N>& index_list);
+
+        /*!
+         * \brief Returns an iterator to the first element in the first dimension of the array.
+         *
+         * \see end()
+         *
+         * \return Iterator to the first element.
+         */
+        const_iterator begin() const;
+
+        /*!
+         * \brief Returns an iterator to the element following the last element in the first dimension of the array.
+         *
+         * \see begin()
+         *
+         * \return Iterator to the element following the last element.
+         */
+        const_iterator end() const;
+
+        /*!
+         * \brief The \ref variant_array_view::const_iterator allows iteration over the first dimension of an array
+         *        in a linear time, whatever the underlying array type is.
+         *
+         * When the array provides `std::begin()` and `std::end()`, the native iterator of the array is used,
+         * otherwise the elements are accessed by their index via the \ref array_mapper.
+         *
+         * A typical use case is like following:
+         * \code{.cpp}
+         *  std::list<int> my_list = {1, 2, 3};
+         *  variant var = std::ref(my_list);
+         *  variant_array_view view = var.create_array_view();
+         *  for (const auto& item : view)
+         *  {
+         *      // remark that the value is stored inside a 'std::reference_wrapper'
+         *      std::cout << item.extract_wrapped_value().to_string() << std::endl;
+         *  }
+         * \endcode
+         *
+         * \remark The iterator is valid as long as the variant_array_view and it corresponding variant is valid and
+         *         the size of the array is not modified.
+         */
+        class RTTR_API const_iterator
+        {
+            public:
+                using self_type = const_iterator;
+                using value_type = variant;
+
+                /*!
+                 * \brief Destroys the variant_array_view::const_iterator
+                 */
+                ~const_iterator();
+
+                /*!
+                 * \brief Creates a copy of \p other
+                 */
+                const_iterator(const const_iterator& other);
+
+                 /*!
+                 * \brief Assigns \p other to `this`.
+                 */
+                const_iterator& operator=(const_iterator other);
+
+                /*!
+                 * \brief Returns the current element, stored inside a `std::reference_wrapper<T>`
+                 *        and copied to a variant.
+                 *
+                 * \remark Elements which cannot be referenced, like the ones of `std::vector<bool>`,
+                 *         are returned by value.
+                 *
+                 * \see variant::extract_wrapped_value(), variant::get_wrapped_value<T>()
+                 */
+                const variant operator*() const;
+
+                /*!
+                 * \brief Returns the current element, stored inside a `std::reference_wrapper<T>`
+                 *        and copied to a variant.
+                 *
+                 * \see variant::extract_wrapped_value(), variant::get_wrapped_value<T>()
+                 */
+                const variant get_value() const;
+
+                /*!
+                 * \brief Pre-increment operator advances the iterator to the next item
+                 *        in the array and returns an iterator to the new current item.
+                 *
+                 * \remark Calling this function on and iterator with value variant_array_view::end()
+                 *         leads to undefinied behaviour.
+                 */
+                const_iterator &operator++();
+
+                /*!
+                 * \brief Post-increment operator advances the iterator to the next item
+                 *        in the array and returns an iterator to the previously current item.
+                 */
+                const_iterator operator++(int);
+
+                /*!
+                 * \brief Returns `true` if \p other points to the same item
+                 *        as this iterator; otherwise returns false.
+                 *
+                 * \see \ref const_iterator::operator!= "operator!="
+                 */
+                bool operator==(const const_iterator& other) const;
+
+                /*!
+                 * \brief Returns true if \p other points to a different item
+                 *        than this iterator; otherwise returns false.
+                 *
+                 * \see \ref operator== "operator=="
+                 */
+                bool operator!=(const const_iterator& other) const;
+
+            private:
+                explicit const_iterator(const detail::array_wrapper_base* array_wrapper) RTTR_NOEXCEPT;
+                void swap(const_iterator& other);
+
+                friend class variant_array_view;
+
+                const detail::array_wrapper_base* m_array_wrapper;
+                detail::iterator_data m_itr;
+        };
+
     private:
         friend class variant;
         friend class argument;
 
-        std::unique_ptr<detail::array_wrapper_base> m_array_wrapper;
+        bool assign_from(const void* data, std::size_t count, const type& element_type);
+
+        RTTR_INLINE detail::array_wrapper_base* get_array_wrapper() RTTR_NOEXCEPT;
+        RTTR_INLINE const detail::array_wrapper_base* get_array_wrapper() const RTTR_NOEXCEPT;
+
+        detail::array_wrapper_storage m_array_wrapper_storage;
 };
 
 } // end namespace rttr
@@ -137,6 +137,27 @@ std::pair<variant_associative_view::const_iterator, bool> variant_associative_vi
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+std::size_t variant_associative_view::insert_range(array_range<argument> keys)
+{
+    return m_view.insert_range(keys);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t variant_associative_view::insert_range(array_range<argument> keys, array_range<argument> values)
+{
+    return m_view.insert_range(keys, values);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool variant_associative_view::reserve(std::size_t size)
+{
+    return m_view.reserve(size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant_associative_view::const_iterator variant_associative_view::find(argument arg)
 {
     const_iterator itr(&m_view);
@@ -260,6 +281,20 @@ const variant variant_associative_view::const_iterator::get_value() const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+instance variant_associative_view::const_iterator::get_key_ref() const
+{
+    return m_view->get_key_ref(m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+instance variant_associative_view::const_iterator::get_value_ref() const
+{
+    return m_view->get_value_ref(m_itr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant_associative_view::const_iterator& variant_associative_view::const_iterator::operator++()
 {
     m_view->advance(m_itr, 1);
@@ -31,6 +31,7 @@
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/variant.h"
+#include "rttr/array_range.h"
 #include "rttr/detail/variant_associative_view/variant_associative_view_p.h"
 
 #include <cstddef>
@@ -193,6 +194,42 @@ class RTTR_API variant_associative_view
          */
         std::pair<const_iterator, bool> insert(argument key, argument value);
 
+        /*!
+         * \brief Inserts all keys of the range \p keys into the container.
+         *
+         * The types of all keys are checked once before the container is modified,
+         * when one key has not the key type of the container, nothing will be inserted.
+         * Containers which support `reserve()` allocate the needed space upfront.
+         *
+         * \remark This function can only be used for containers which store only the key (e.g. `std::set<K>`).
+         *
+         * \return The number of inserted elements.
+         */
+        std::size_t insert_range(array_range<argument> keys);
+
+        /*!
+         * \brief Inserts the key-value pairs, formed by \p keys and \p values, into the container.
+         *
+         * The types of all keys and values are checked once before the container is modified,
+         * when one argument has not the expected type or both ranges have a different size,
+         * nothing will be inserted.
+         *
+         * \remark This function can only be used for containers which store a key and a value (e.g. `std::map<K, T>`).
+         *
+         * \return The number of inserted elements.
+         */
+        std::size_t insert_range(array_range<argument> keys, array_range<argument> values);
+
+        /*!
+         * \brief Increases the capacity of the container to at least \p size elements.
+         *
+         * \remark Only containers which provide a `reserve()` member function (e.g. `std::unordered_map<K, T>`)
+         *         are supported, for all other containers this function does nothing.
+         *
+         * \return `True`, when the container supports reserving, otherwise `false`.
+         */
+        bool reserve(std::size_t size);
+
         /*!
          * \brief Finds an element with specific key \p key .
          *
@@ -200,6 +237,23 @@ class RTTR_API variant_associative_view
          */
         const_iterator find(argument key);
 
+        /*!
+         * \brief Finds an element with specific key \p key.
+         *
+         * When \p key is not of the key type of the container, it will be converted to it once
+         * (e.g. a \ref string_view to a `std::string`) and the lookup is done with the converted key.
+         *
+         * \return The element with key equivalent to \p key. When no element is found
+         *         or \p key cannot be converted to the key type, the end iterator is returned.
+         */
+#ifdef DOXYGEN
+        template<typename Key>
+        const_iterator find(const Key& key);
+#else
+        template<typename Key, typename Tp = detail::enable_if_t<!std::is_same<Key, argument>::value>>
+        const_iterator find(const Key& key);
+#endif
+
         /*!
          * \brief Removes the element (if one exists) with the key equivalent to \p key.
          *
@@ -207,6 +261,21 @@ class RTTR_API variant_associative_view
          */
         std::size_t erase(argument key);
 
+        /*!
+         * \brief Removes the element (if one exists) with the key equivalent to \p key.
+         *
+         * When \p key is not of the key type of the container, it will be converted to it once.
+         *
+         * \return The number of elements removed.
+         */
+#ifdef DOXYGEN
+        template<typename Key>
+        std::size_t erase(const Key& key);
+#else
+        template<typename Key, typename Tp = detail::enable_if_t<!std::is_same<Key, argument>::value>>
+        std::size_t erase(const Key& key);
+#endif
+
         /*!
          * \brief Removes all elements from the container.
          *
@@ -250,6 +319,21 @@ class RTTR_API variant_associative_view
          */
         std::pair<const_iterator, const_iterator> equal_range(argument key);
 
+        /*!
+         * \brief Returns a range containing all elements with the given \p key in the container.
+         *
+         * When \p key is not of the key type of the container, it will be converted to it once.
+         *
+         * \see equal_range(argument)
+         */
+#ifdef DOXYGEN
+        template<typename Key>
+        std::pair<const_iterator, const_iterator> equal_range(const Key& key);
+#else
+        template<typename Key, typename Tp = detail::enable_if_t<!std::is_same<Key, argument>::value>>
+        std::pair<const_iterator, const_iterator> equal_range(const Key& key);
+#endif
+
         /*!
          * \brief Returns an iterator to the first element of the container.
          *
@@ -338,6 +422,33 @@ class RTTR_API variant_associative_view
                  */
                 const variant get_value() const;
 
+                /*!
+                 * \brief Returns a non-owning reference to the current key.
+                 *
+                 * In contrast to get_key(), no variant will be created; the key can be accessed
+                 * directly via instance::try_convert<T>() or be used to retrieve its \ref property "properties".
+                 *
+                 * \remark The returned instance is only valid as long as the element exists in the container.
+                 *         When the container itself is `const`, the key must not be modified through the instance.
+                 *
+                 * \see get_value_ref()
+                 */
+                instance get_key_ref() const;
+
+                /*!
+                 * \brief Returns a non-owning reference to the current value.
+                 *
+                 * In contrast to get_value(), no variant will be created; the value can be accessed
+                 * directly via instance::try_convert<T>() or be used to retrieve its \ref property "properties".
+                 * For containers, which store only the key (e.g. `std::set<K>`) an invalid instance is returned.
+                 *
+                 * \remark The returned instance is only valid as long as the element exists in the container.
+                 *         When the container itself is `const`, the value must not be modified through the instance.
+                 *
+                 * \see get_key_ref()
+                 */
+                instance get_value_ref() const;
+
                 /*!
                  * \brief Pre-increment operator advances the iterator to the next item
                  *        in the container and returns an iterator to the new current item.
@@ -422,4 +533,6 @@ class RTTR_API variant_associative_view
 
 } // end namespace rttr
 
+#include "rttr/detail/variant_associative_view/variant_associative_view_impl.h"
+
 #endif // RTTR_VARIANT_ASSOCIATIVE_VIEW_H_
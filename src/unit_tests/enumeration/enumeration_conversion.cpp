@@ -43,6 +43,26 @@ enum class access_t : int
     exec = 4
 };
 
+enum class permission_t : unsigned char
+{
+    none        = 0,
+    read        = 1,
+    write       = 2,
+    read_write  = 3,
+    exec        = 4,
+    all         = 7,
+    admin       = 128
+};
+
+enum sparse_t
+{
+    sparse_min      = -1000,
+    sparse_zero     = 0,
+    sparse_1000     = 1000,
+    sparse_alias    = 1000,
+    sparse_max      = 100000
+};
+
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
@@ -54,6 +74,26 @@ RTTR_REGISTRATION
         value("write",  access_t::write),
         value("exec",   access_t::exec)
     );
+
+    registration::enumeration<permission_t>("permission_t")
+    (
+        value("none",       permission_t::none),
+        value("read",       permission_t::read),
+        value("write",      permission_t::write),
+        value("read_write", permission_t::read_write),
+        value("exec",       permission_t::exec),
+        value("all",        permission_t::all),
+        value("admin",      permission_t::admin)
+    );
+
+    registration::enumeration<sparse_t>("sparse_t")
+    (
+        value("sparse_min",     sparse_min),
+        value("sparse_zero",    sparse_zero),
+        value("sparse_1000",    sparse_1000),
+        value("sparse_alias",   sparse_alias),
+        value("sparse_max",     sparse_max)
+    );
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -102,3 +142,81 @@ TEST_CASE("enumeration - name_to_value()", "[enumeration]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - value_to_name() - sparse values", "[enumeration]")
+{
+    enumeration e = type::get<sparse_t>().get_enumeration();
+
+    CHECK(e.value_to_name(sparse_min)       == "sparse_min");
+    CHECK(e.value_to_name(sparse_zero)      == "sparse_zero");
+    CHECK(e.value_to_name(sparse_max)       == "sparse_max");
+    // the first registered name is used for duplicated values
+    CHECK(e.value_to_name(sparse_alias)     == "sparse_1000");
+    CHECK(e.value_to_name(1000)             == "sparse_1000");
+
+    CHECK(e.value_to_name(1).empty()        == true);
+    CHECK(e.value_to_name(-999).empty()     == true);
+    CHECK(e.value_to_name(100001).empty()   == true);
+
+    CHECK(e.name_to_value("sparse_alias").get_value<sparse_t>() == sparse_1000);
+    CHECK(e.name_to_value("sparse_max").get_value<sparse_t>()   == sparse_max);
+    CHECK(e.name_to_value("sparse").is_valid()                  == false);
+    CHECK(e.name_to_value("").is_valid()                        == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - value_to_flag_names()", "[enumeration]")
+{
+    enumeration e = type::get<permission_t>().get_enumeration();
+
+    // exact names are preferred
+    CHECK(e.value_to_flag_names(permission_t::none)         == "none");
+    CHECK(e.value_to_flag_names(permission_t::read_write)   == "read_write");
+    CHECK(e.value_to_flag_names(permission_t::all)          == "all");
+
+    CHECK(e.value_to_flag_names(static_cast<permission_t>(5))   == "read|exec");
+    CHECK(e.value_to_flag_names(static_cast<permission_t>(135)) == "read|write|exec|admin");
+
+    // underlying type and enum_flags
+    CHECK(e.value_to_flag_names(static_cast<unsigned char>(6))  == "write|exec");
+    enum_flags<permission_t> flags = permission_t::read;
+    flags |= permission_t::admin;
+    CHECK(e.value_to_flag_names(flags)                          == "read|admin");
+
+    // invalid
+    CHECK(e.value_to_flag_names(static_cast<permission_t>(8)).empty()   == true);
+    CHECK(e.value_to_flag_names(42).empty()                             == true);
+
+    // negative
+    e = type::get_by_name("access_unknown").get_enumeration();
+    CHECK(e.value_to_flag_names(permission_t::read).empty() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("enumeration - flag_names_to_value()", "[enumeration]")
+{
+    enumeration e = type::get<permission_t>().get_enumeration();
+
+    REQUIRE(e.flag_names_to_value("read").is_type<permission_t>() == true);
+    CHECK(e.flag_names_to_value("read").get_value<permission_t>()                   == permission_t::read);
+    CHECK(e.flag_names_to_value("read|exec").get_value<permission_t>()              == static_cast<permission_t>(5));
+    CHECK(e.flag_names_to_value(" read_write | exec ").get_value<permission_t>()    == permission_t::all);
+    CHECK(e.flag_names_to_value("none|admin").get_value<permission_t>()             == permission_t::admin);
+
+    // round trip
+    const auto value = static_cast<permission_t>(133);
+    CHECK(e.flag_names_to_value(e.value_to_flag_names(value)).get_value<permission_t>() == value);
+
+    // invalid
+    CHECK(e.flag_names_to_value("").is_valid()              == false);
+    CHECK(e.flag_names_to_value("read|").is_valid()         == false);
+    CHECK(e.flag_names_to_value("read|unknown").is_valid()  == false);
+
+    // negative
+    e = type::get_by_name("access_unknown").get_enumeration();
+    CHECK(e.flag_names_to_value("read").is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
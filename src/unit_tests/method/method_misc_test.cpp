@@ -180,6 +180,10 @@ TEST_CASE("method - get_metadata()", "[method]")
     var = meth.get_metadata("Text");
     REQUIRE(var.is_type<std::string>() == true);
     CHECK(var.get_value<std::string>() == "Some funky description");
+
+    var = meth.get_metadata(interned_string("Text"));
+    REQUIRE(var.is_type<std::string>() == true);
+    CHECK(var.get_value<std::string>() == "Some funky description");
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -60,6 +60,23 @@ TEST_CASE("array_range<T> - size", "[array_range]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("array_range<T> - predicate", "[array_range]")
+{
+    int list[5] = {1, 2, 3, 4, 5};
+    auto range = array_range<int>(&list[0], 5, detail::default_predicate<int>([](const int& value) { return (value % 2 == 0); }));
+    CHECK(range.size() == 2);
+    CHECK(range.empty() == false);
+    CHECK(*range.begin() == 2);
+    CHECK(*range.rbegin() == 4);
+
+    auto empty_range = array_range<int>(&list[0], 5, detail::default_predicate<int>([](const int&) { return false; }));
+    CHECK(empty_range.size() == 0);
+    CHECK(empty_range.empty() == true);
+    CHECK(empty_range.begin() == empty_range.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("array_range<T> - begin()", "[array_range]")
 {
     int list[5] = {1, 2, 3, 4, 5};
@@ -0,0 +1,129 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/detail/misc/flat_hash_map.h>
+
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_hash_map - insert & find", "[flat_hash_map]")
+{
+    detail::flat_hash_map<std::string, int, detail::hash> map;
+
+    for (int i = 0; i < 1000; ++i)
+        map.insert(std::to_string(i), i);
+
+    map.insert(std::string("42"), 1); // the first inserted element wins
+
+    REQUIRE(map.size() == 1000);
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto itr = map.find(std::to_string(i));
+        REQUIRE(itr != map.end());
+        CHECK(*itr == i);
+    }
+
+    CHECK(*map.find(string_view("42")) == 42);
+    CHECK(*map.find(string_view("42"), detail::generate_hash("42", 2)) == 42);
+    CHECK(map.find(string_view("1000")) == map.end());
+
+    // values are stored in insertion order
+    CHECK(map.value_data().front() == 0);
+    CHECK(map.value_data().back() == 999);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_hash_map - erase", "[flat_hash_map]")
+{
+    detail::flat_hash_map<std::string, int, detail::hash> map;
+
+    for (int i = 0; i < 100; ++i)
+        map.insert(std::to_string(i), i);
+
+    for (int i = 0; i < 100; i += 2)
+        map.erase(std::to_string(i));
+
+    map.erase(std::string("100"));
+
+    REQUIRE(map.size() == 50);
+    for (int i = 0; i < 100; ++i)
+    {
+        auto itr = map.find(std::to_string(i));
+        if (i % 2 == 0)
+            CHECK(itr == map.end());
+        else
+            CHECK(*itr == i);
+    }
+
+    // reinsert after erase
+    map.insert(std::string("0"), 0);
+    CHECK(*map.find(std::string("0")) == 0);
+    CHECK(map.size() == 51);
+
+    map.clear();
+    CHECK(map.size() == 0);
+    CHECK(map.find(std::string("1")) == map.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("flat_hash_multimap - insert & find_next", "[flat_hash_map]")
+{
+    detail::flat_hash_multimap<string_view, int> map;
+
+    map.insert(string_view("foo"), 1);
+    map.insert(string_view("bar"), 2);
+    map.insert(string_view("foo"), 3);
+    map.insert(string_view("foo"), 4);
+
+    REQUIRE(map.size() == 4);
+
+    std::vector<int> values;
+    for (auto itr = map.find(string_view("foo")); itr != map.end(); itr = map.find_next(itr))
+        values.push_back(*itr);
+
+    CHECK(values == std::vector<int>({1, 3, 4}));
+
+    auto itr = map.find(string_view("bar"));
+    REQUIRE(itr != map.end());
+    CHECK(*itr == 2);
+    CHECK(map.find_next(itr) == map.end());
+
+    CHECK(map.find(string_view("baz")) == map.end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,146 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <rttr/hot_path_counters.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+using namespace std;
+
+struct counter_test
+{
+    counter_test() {}
+    int add(int value) { return (m_value += value); }
+
+    int m_value = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<counter_test>("counter_test")
+        .constructor<>()
+        .property("value", &counter_test::m_value)
+        .method("add", &counter_test::add)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#if RTTR_HOT_PATH_COUNTERS
+
+static const counter_record* find_record(const std::vector<counter_record>& record_list, counter_kind kind, const std::string& name)
+{
+    auto itr = std::find_if(record_list.cbegin(), record_list.cend(),
+                            [&](const counter_record& record) { return (record.kind == kind && record.name == name); });
+    return (itr != record_list.cend() ? &(*itr) : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("hot_path_counters - count calls", "[hot_path_counters]")
+{
+    CHECK(hot_path_counters::is_enabled() == true);
+    hot_path_counters::reset();
+
+    type t = type::get<counter_test>();
+    counter_test obj;
+    t.get_method("add").invoke(obj, 1);
+    t.get_method("add").invoke(obj, 2);
+    t.get_property("value").set_value(obj, 5);
+    t.get_property("value").get_value(obj);
+    t.get_constructor().invoke();
+
+    variant var = 23;
+    var.convert(type::get<std::string>());
+
+    // other threads are merged as well, also after they have finished
+    std::thread worker([]()
+    {
+        counter_test obj;
+        type::get<counter_test>().get_method("add").invoke(obj, 3);
+    });
+    worker.join();
+
+    const auto record_list = hot_path_counters::get_snapshot(100);
+
+    auto record = find_record(record_list, counter_kind::method_invoke, "counter_test::add( int )");
+    REQUIRE(record != nullptr);
+    CHECK(record->count == 3);
+    CHECK(record->nanoseconds > 0);
+
+    record = find_record(record_list, counter_kind::property_set_value, "counter_test::value");
+    REQUIRE(record != nullptr);
+    CHECK(record->count == 1);
+
+    record = find_record(record_list, counter_kind::property_get_value, "counter_test::value");
+    REQUIRE(record != nullptr);
+    CHECK(record->count == 1);
+
+    record = find_record(record_list, counter_kind::constructor_invoke, "std::shared_ptr<counter_test>( )");
+    REQUIRE(record != nullptr);
+    CHECK(record->count == 1);
+
+    record = find_record(record_list, counter_kind::variant_convert, "int -> std::string");
+    REQUIRE(record != nullptr);
+    CHECK(record->count == 1);
+
+    const auto is_sorted = std::is_sorted(record_list.cbegin(), record_list.cend(),
+                                          [](const counter_record& left, const counter_record& right)
+                                          { return left.nanoseconds > right.nanoseconds; });
+    CHECK(is_sorted == true);
+    CHECK(hot_path_counters::get_snapshot(2).size() == 2);
+
+    hot_path_counters::reset();
+    CHECK(hot_path_counters::get_snapshot(100).empty() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+#else
+
+TEST_CASE("hot_path_counters - disabled", "[hot_path_counters]")
+{
+    CHECK(hot_path_counters::is_enabled() == false);
+
+    counter_test obj;
+    type::get<counter_test>().get_method("add").invoke(obj, 1);
+
+    CHECK(hot_path_counters::get_snapshot(100).empty() == true);
+}
+
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,218 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/interned_string.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+#include "unit_tests/variant/test_enums.h"
+
+using namespace rttr;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("interned_string - interned_string()", "[interned_string]")
+{
+    interned_string text;
+
+    CHECK(text.empty() == true);
+    CHECK(text.size() == 0);
+    CHECK(std::string(text.c_str()) == "");
+    CHECK(text == interned_string(""));
+    CHECK(text.get_hash() == std::hash<string_view>()(string_view()));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("interned_string - interned_string(string_view)", "[interned_string]")
+{
+    std::string buffer = "Hello World";
+    interned_string text1(buffer);
+    interned_string text2(string_view("Hello World, again", 11));
+    interned_string text3("Hello");
+
+    CHECK(text1.empty() == false);
+    CHECK(text1.size() == 11);
+    CHECK(text1.str() == "Hello World");
+    CHECK(std::string(text1.c_str()) == "Hello World");
+
+    // the same entry is shared
+    CHECK(text1 == text2);
+    CHECK(text1.c_str() == text2.c_str());
+    CHECK(text1 != text3);
+
+    // the interned characters do not depend on the source
+    buffer = "Changed";
+    CHECK(text1.str() == "Hello World");
+
+    CHECK(text1.get_hash() == std::hash<string_view>()(string_view("Hello World")));
+    CHECK(std::hash<interned_string>()(text1) == text1.get_hash());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("interned_string - operator<", "[interned_string]")
+{
+    // the order of interning must not influence the order of the strings
+    interned_string b("interned_string_less_b");
+    interned_string a("interned_string_less_a");
+
+    CHECK(a < b);
+    CHECK((b < a) == false);
+    CHECK((a < a) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("interned_string - thread safety", "[interned_string]")
+{
+    std::vector<interned_string> results(4);
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        threads.emplace_back([&results, i]()
+        {
+            for (int k = 0; k < 1000; ++k)
+                results[i] = interned_string("interned_string_thread_" + std::to_string(k));
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& result : results)
+        CHECK(result == interned_string("interned_string_thread_999"));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant - interned_string", "[variant]")
+{
+    variant var = interned_string("42");
+    REQUIRE(var.is_type<interned_string>() == true);
+    CHECK(var.get_value<interned_string>() == interned_string("42"));
+
+    SECTION("conversion to basic types")
+    {
+        CHECK(var.can_convert<int>() == true);
+        CHECK(var.to_int() == 42);
+        CHECK(var.to_double() == 42.0);
+        CHECK(var.to_uint8() == 42);
+        CHECK(var.to_bool() == true);
+        CHECK(var.to_string() == "42");
+
+        bool ok = false;
+        CHECK(var.convert<int64_t>(&ok) == 42);
+        CHECK(ok == true);
+
+        REQUIRE(var.convert(type::get<float>()) == true);
+        CHECK(var.is_type<float>() == true);
+        CHECK(var.get_value<float>() == 42.0f);
+    }
+
+    SECTION("conversion from basic types")
+    {
+        variant int_var = 23;
+        CHECK(int_var.can_convert<interned_string>() == true);
+        CHECK(int_var.convert<interned_string>() == interned_string("23"));
+
+        variant string_var = std::string("text");
+        REQUIRE(string_var.convert(type::get<interned_string>()) == true);
+        CHECK(string_var.get_value<interned_string>() == interned_string("text"));
+    }
+
+    SECTION("enumeration")
+    {
+        variant enum_var = interned_string("VALUE_2");
+        REQUIRE(enum_var.convert(type::get<variant_enum_test>()) == true);
+        CHECK(enum_var.get_value<variant_enum_test>() == variant_enum_test::VALUE_2);
+
+        CHECK(enum_var.convert<interned_string>() == interned_string("VALUE_2"));
+    }
+
+    SECTION("comparison")
+    {
+        CHECK(var == variant(interned_string("42")));
+        CHECK(var != variant(interned_string("43")));
+        CHECK(var == variant(std::string("42")));
+        CHECK(var == variant(42));
+
+        CHECK(var < variant(interned_string("5")));
+        CHECK((variant(interned_string("5")) < var) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant - string_view", "[variant]")
+{
+    const std::string buffer = "12,-3.5";
+    variant var = string_view(buffer.data(), 2);
+    REQUIRE(var.is_type<string_view>() == true);
+
+    SECTION("conversion")
+    {
+        CHECK(var.can_convert<int>() == true);
+        CHECK(var.to_int() == 12);
+        CHECK(var.to_string() == "12");
+
+        bool ok = false;
+        CHECK(var.convert<interned_string>(&ok) == interned_string("12"));
+        CHECK(ok == true);
+
+        variant double_var = string_view(buffer.data() + 3, 4);
+        CHECK(double_var.to_double() == -3.5);
+
+        // a string_view cannot own the converted characters
+        variant int_var = 12;
+        CHECK(int_var.can_convert<string_view>() == false);
+    }
+
+    SECTION("comparison")
+    {
+        CHECK(var == variant(string_view("12")));
+        CHECK(var == variant(std::string("12")));
+        CHECK(var == variant(12));
+        CHECK(var < variant(string_view("2")));
+    }
+
+    SECTION("enumeration")
+    {
+        variant enum_var = string_view("VALUE_1");
+        REQUIRE(enum_var.convert(type::get<variant_enum_test>()) == true);
+        CHECK(enum_var.get_value<variant_enum_test>() == variant_enum_test::VALUE_1);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
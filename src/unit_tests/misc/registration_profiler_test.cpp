@@ -0,0 +1,98 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <rttr/registration_profiler.h>
+
+#include <string>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+using namespace std;
+
+struct profiler_test
+{
+    profiler_test() {}
+    int get_value() const { return m_value; }
+
+    int m_value = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration_profiler - class scope", "[registration_profiler]")
+{
+    const bool was_enabled = registration_profiler::is_enabled();
+    registration_profiler::set_enabled(true);
+    registration_profiler::clear();
+
+    registration::class_<profiler_test>("profiler_test")
+        .constructor<>()
+        .property("value", &profiler_test::m_value)
+        .method("get_value", &profiler_test::get_value);
+
+    registration_profiler::set_enabled(was_enabled);
+
+    const auto record_list = registration_profiler::get_records();
+    REQUIRE(record_list.size() == 1);
+
+    const auto& record = record_list.front();
+    CHECK(record.is_block == false);
+    CHECK(record.name == "profiler_test");
+    CHECK(record.parent_index == registration_profile_record::no_parent);
+    CHECK(record.nanoseconds > 0);
+    CHECK(record.type_count >= 1);
+    CHECK(record.item_count == 4); // constructor, destructor, property and method
+    CHECK(record.allocated_bytes > 0);
+
+    const auto report = registration_profiler::get_report();
+    CHECK(report.find("\"kind\": \"class\", \"name\": \"profiler_test\", \"parent\": -1") != std::string::npos);
+    CHECK(report.find("\"items\": 4") != std::string::npos);
+
+    registration_profiler::clear();
+    CHECK(registration_profiler::get_records().empty() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration_profiler - disabled", "[registration_profiler]")
+{
+    const bool was_enabled = registration_profiler::is_enabled();
+    registration_profiler::set_enabled(false);
+    registration_profiler::clear();
+
+    registration::class_<profiler_test>("profiler_test")
+        .property("value", &profiler_test::m_value);
+
+    registration_profiler::set_enabled(was_enabled);
+
+    CHECK(registration_profiler::get_records().empty() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,143 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+
+#include <algorithm>
+#include <string>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+using namespace std;
+
+struct statistics_small_test
+{
+    int value = 0;
+};
+
+struct statistics_large_test
+{
+    statistics_large_test() {}
+    int get_value() const { return value_1; }
+
+    enum class color { red, green, blue };
+
+    int         value_1 = 0;
+    int         value_2 = 0;
+    std::string value_3;
+    double      value_4 = 0.0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<statistics_small_test>("statistics_small_test")
+        .property("value", &statistics_small_test::value)
+        ;
+
+    registration::class_<statistics_large_test>("statistics_large_test")
+        .constructor<>()
+        .property("value_1", &statistics_large_test::value_1)
+        (
+            metadata("description", "the first value"),
+            metadata("unit", "meter")
+        )
+        .property("value_2", &statistics_large_test::value_2)
+        .property("value_3", &statistics_large_test::value_3)
+        .property("value_4", &statistics_large_test::value_4)
+        .method("get_value", &statistics_large_test::get_value)
+        .enumeration<statistics_large_test::color>("statistics_large_test::color")
+        (
+            value("red",    statistics_large_test::color::red),
+            value("green",  statistics_large_test::color::green),
+            value("blue",   statistics_large_test::color::blue)
+        );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const memory_usage* find_usage(const registration_statistics& stats, const type& t)
+{
+    auto itr = std::find_if(stats.type_list.cbegin(), stats.type_list.cend(),
+                            [&t](const type_memory_usage& item) { return (item.registered_type == t); });
+    return (itr != stats.type_list.cend() ? &itr->usage : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration::get_statistics() - per type", "[registration_statistics]")
+{
+    const auto stats = registration::get_statistics();
+
+    const auto small_usage = find_usage(stats, type::get<statistics_small_test>());
+    const auto large_usage = find_usage(stats, type::get<statistics_large_test>());
+    const auto enum_usage  = find_usage(stats, type::get<statistics_large_test::color>());
+    REQUIRE(small_usage != nullptr);
+    REQUIRE(large_usage != nullptr);
+    REQUIRE(enum_usage != nullptr);
+
+    CHECK(small_usage->types > 0);
+    CHECK(small_usage->properties > 0);
+    CHECK(small_usage->methods == 0);
+    CHECK(small_usage->metadata == 0);
+
+    CHECK(large_usage->properties > small_usage->properties);
+    CHECK(large_usage->methods > 0);
+    CHECK(large_usage->constructors > 0);
+    CHECK(large_usage->metadata >= 2 * sizeof(variant));
+    CHECK(large_usage->get_total() > small_usage->get_total());
+
+    CHECK(enum_usage->enumerations > 0);
+    CHECK(enum_usage->names > 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("registration::get_statistics() - total", "[registration_statistics]")
+{
+    const auto stats = registration::get_statistics();
+
+    REQUIRE(stats.type_list.empty() == false);
+    CHECK(stats.type_list.size() == type::get_types().size());
+
+    memory_usage sum;
+    for (const auto& item : stats.type_list)
+        sum += item.usage;
+
+    CHECK(stats.total.get_total() >= sum.get_total());
+    CHECK(stats.total.names > sum.names);
+
+    const auto is_sorted = std::is_sorted(stats.type_list.cbegin(), stats.type_list.cend(),
+                                          [](const type_memory_usage& left, const type_memory_usage& right)
+                                          { return left.usage.get_total() > right.usage.get_total(); });
+    CHECK(is_sorted == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,225 @@
+
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014, 2015 - 2017 Axel Menzel <info@rttr.org>                     *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+#include <rttr/type>
+#include <rttr/sorted_vector_map.h>
+#include <rttr/sorted_vector_set.h>
+
+#include <string>
+#include <vector>
+
+#include <catch/catch.hpp>
+
+using namespace rttr;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("sorted_vector_map - insert & find", "[sorted_vector_map]")
+{
+    sorted_vector_map<int, std::string> map = { { 3, "three" }, { 1, "one" }, { 2, "two" }, { 1, "uno" } };
+
+    REQUIRE(map.size() == 3);
+    CHECK(map.begin()->first == 1);
+    CHECK(map.begin()->second == "one"); // the first inserted element wins
+
+    auto ret = map.insert(std::make_pair(0, std::string("zero")));
+    CHECK(ret.second == true);
+    CHECK(ret.first == map.begin());
+
+    ret = map.insert(std::make_pair(2, std::string("zwei")));
+    CHECK(ret.second == false);
+    CHECK(ret.first->second == "two");
+
+    CHECK(map.find(3)->second == "three");
+    CHECK(map.find(4) == map.end());
+    CHECK(map.count(2) == 1);
+    CHECK(map.count(42) == 0);
+
+    auto range = map.equal_range(2);
+    CHECK(std::distance(range.first, range.second) == 1);
+    CHECK(range.first->second == "two");
+
+    map[5] = "five";
+    CHECK(map.size() == 5);
+    CHECK((map.end() - 1)->second == "five");
+
+    CHECK(map.erase(5) == 1);
+    CHECK(map.erase(5) == 0);
+    CHECK(map.size() == 4);
+
+    // the elements are stored contiguous
+    CHECK(map.data() == &*map.begin());
+    CHECK(&map.values()[1] == &*map.find(1));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("sorted_vector_map - bulk insert", "[sorted_vector_map]")
+{
+    sorted_vector_map<int, int> map = { { 2, 20 }, { 4, 40 } };
+
+    std::vector<std::pair<int, int>> items = { { 5, 50 }, { 1, 10 }, { 4, 400 }, { 3, 30 }, { 1, 100 } };
+    map.insert(items.begin(), items.end());
+
+    REQUIRE(map.size() == 5);
+    int key = 1;
+    for (const auto& item : map)
+    {
+        CHECK(item.first == key);
+        CHECK(item.second == key * 10);
+        ++key;
+    }
+
+    std::vector<std::pair<int, int>> sorted_items = { { 6, 60 }, { 7, 70 } };
+    map.insert(sorted_unique, sorted_items.begin(), sorted_items.end());
+    CHECK(map.size() == 7);
+    CHECK(map.find(7)->second == 70);
+
+    sorted_vector_map<int, int> other(sorted_unique, sorted_items.begin(), sorted_items.end());
+    CHECK(other.size() == 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct transparent_less
+{
+    using is_transparent = void;
+
+    bool operator()(const std::string& lhs, const std::string& rhs) const { return lhs < rhs; }
+    bool operator()(const std::string& lhs, string_view rhs) const { return string_view(lhs) < rhs; }
+    bool operator()(string_view lhs, const std::string& rhs) const { return lhs < string_view(rhs); }
+};
+
+TEST_CASE("sorted_vector_map - heterogeneous lookup", "[sorted_vector_map]")
+{
+    const sorted_vector_map<std::string, int, transparent_less> map = { { "one", 1 }, { "two", 2 } };
+
+    CHECK(map.find(string_view("two"))->second == 2);
+    CHECK(map.find(string_view("three")) == map.end());
+    CHECK(map.count(string_view("one")) == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("sorted_vector_set - insert & find", "[sorted_vector_set]")
+{
+    sorted_vector_set<int> set = { 5, 3, 1, 3 };
+
+    REQUIRE(set.size() == 3);
+    CHECK(std::vector<int>(set.begin(), set.end()) == std::vector<int>({ 1, 3, 5 }));
+
+    CHECK(set.insert(2).second == true);
+    CHECK(set.insert(2).second == false);
+    CHECK(set.find(2) == set.begin() + 1);
+    CHECK(set.lower_bound(4) == set.find(5));
+    CHECK(set.upper_bound(3) == set.find(5));
+
+    set.erase(set.begin());
+    CHECK(*set.begin() == 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("sorted_vector_map - variant_associative_view", "[sorted_vector_map]")
+{
+    sorted_vector_map<int, std::string> map = { { 1, "one" }, { 2, "two" }, { 3, "three" } };
+
+    variant var = std::ref(map);
+    REQUIRE(var.is_associative_container() == true);
+
+    auto view = var.create_associative_view();
+    CHECK(view.get_key_type() == type::get<int>());
+    CHECK(view.get_value_type() == type::get<std::string>());
+    CHECK(view.get_size() == 3);
+
+    auto itr = view.find(2);
+    REQUIRE(itr != view.end());
+    CHECK(itr.get_value().to_string() == "two");
+    CHECK(itr.get_key().get_type() == type::get<std::reference_wrapper<const int>>());
+
+    CHECK(view.insert(0, std::string("zero")).second == true);
+    CHECK(view.insert(0, std::string("null")).second == false);
+    CHECK(view.erase(3) == 1);
+
+    int k1 = 7, k2 = 5, k3 = 6;
+    std::string v1 = "seven", v2 = "five", v3 = "six";
+    std::vector<argument> keys = { k1, k2, k3 };
+    std::vector<argument> values = { v1, v2, v3 };
+    CHECK(view.insert_range(array_range<argument>(keys.data(), keys.size()),
+                            array_range<argument>(values.data(), values.size())) == 3);
+
+    std::vector<int> expected_keys = { 0, 1, 2, 5, 6, 7 };
+    std::vector<int> found_keys;
+    for (const auto& item : view)
+        found_keys.push_back(item.first.get_wrapped_value<int>());
+    CHECK(found_keys == expected_keys);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("sorted_vector_set - variant_associative_view", "[sorted_vector_set]")
+{
+    sorted_vector_set<std::string> set = { "b", "a" };
+
+    variant var = std::ref(set);
+    auto view = var.create_associative_view();
+    REQUIRE(view.is_valid() == true);
+    CHECK(view.get_value_type().is_valid() == false);
+
+    std::string k1 = "d", k2 = "c";
+    std::vector<argument> keys = { k1, k2 };
+    CHECK(view.insert_range(array_range<argument>(keys.data(), keys.size())) == 2);
+    CHECK(set.size() == 4);
+    CHECK(*set.begin() == "a");
+    CHECK(view.find(string_view("c")) != view.end());
+
+    const auto& const_set = set;
+    variant var_const = std::cref(const_set);
+    CHECK(var_const.create_associative_view().insert(std::string("e")).second == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("sorted_vector_map - variant_array_view", "[sorted_vector_map]")
+{
+    sorted_vector_set<int> set = { 3, 2, 1 };
+
+    variant var = std::cref(set.values());
+    auto view = var.create_array_view();
+    REQUIRE(view.is_valid() == true);
+    CHECK(view.get_size() == 3);
+    CHECK(view.get_value(0).to_int() == 1);
+    CHECK(view.set_value(0, 42) == false);
+
+    REQUIRE(view.is_contiguous() == true);
+    auto data = view.get_contiguous_data();
+    CHECK(data.data == set.data());
+    CHECK(data.is_read_only == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
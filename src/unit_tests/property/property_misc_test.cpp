@@ -56,6 +56,9 @@ int prop_misc_test::s_value = 0;
 RTTR_REGISTRATION
 {
     registration::class_<prop_misc_test>("prop_misc_test")
+        (
+            metadata("Text", "This is the class description")
+        )
         .property("value_1", &prop_misc_test::value_1)
         (
             metadata("Text", "This is some description text")
@@ -212,6 +215,32 @@ TEST_CASE("property - get_metadata()", "[property]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("property - get_metadata() - interned key", "[property]")
+{
+    static const interned_string text_key("Text");
+    static const interned_string invalid_key("Invalid Key");
+
+    property prop = type::get<prop_misc_test>().get_property("value_1");
+    CHECK(prop.get_metadata(text_key) == "This is some description text");
+    CHECK(prop.get_metadata(invalid_key).is_valid() == false);
+    CHECK(prop.get_metadata(interned_string()).is_valid() == false);
+
+    prop = type::get<prop_misc_test>().get_property("value_2");
+    CHECK(prop.get_metadata(text_key).is_valid() == false);
+
+    prop = type::get<prop_misc_test>().get_property("");
+    CHECK(prop.get_metadata(text_key).is_valid() == false);
+
+    // type metadata
+    const type t = type::get<prop_misc_test>();
+    CHECK(t.get_metadata(text_key) == "This is the class description");
+    CHECK(t.get_metadata("Text") == "This is the class description");
+    CHECK(t.get_metadata(invalid_key).is_valid() == false);
+    CHECK(type::get<int>().get_metadata(text_key).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("property - compare operators()", "[property]")
 {
     property prop1  = type::get<prop_misc_test>().get_property("value_1");
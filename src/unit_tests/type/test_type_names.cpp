@@ -29,6 +29,10 @@
 #include <catch/catch.hpp>
 #include <rttr/type>
 
+#include <string>
+#include <tuple>
+#include <vector>
+
 using namespace rttr;
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -55,3 +59,19 @@ TEST_CASE("Test rttr::type - type::get_by_name", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("type get_name - long template name", "[type]")
+{
+    using vec = std::vector<std::string>;
+    using long_name_type = std::tuple<vec, vec, vec, vec, vec, vec, vec, vec, vec, vec,
+                                      vec, vec, vec, vec, vec, vec, vec, vec, vec, vec>;
+
+    const auto raw_name = detail::get_type_name<long_name_type>();
+    CHECK(raw_name.size() > 900);
+    CHECK(raw_name.back() == '>');
+
+    const auto name = type::get<long_name_type>().get_name();
+    CHECK(name.to_string().find("std::tuple<") == 0);
+    CHECK(type::get_by_name(name) == type::get<long_name_type>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
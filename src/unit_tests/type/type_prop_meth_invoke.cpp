@@ -32,6 +32,8 @@ struct type_prop_invoke_test_base
 {
     int p1 = 12;
 
+    int get_p1() const { return p1; }
+
     RTTR_ENABLE()
 };
 
@@ -50,7 +52,8 @@ using namespace rttr;
 RTTR_REGISTRATION
 {
     registration::class_<type_prop_invoke_test_base>("type_prop_invoke_test_base")
-        .property("p1", &type_prop_invoke_test_base::p1);
+        .property("p1", &type_prop_invoke_test_base::p1)
+        .method("get_p1", &type_prop_invoke_test_base::get_p1);
 
     registration::class_<type_prop_invoke_test>("type_prop_invoke_test")
         .property("p2", &type_prop_invoke_test::p2);
@@ -101,3 +104,70 @@ TEST_CASE("Test property shortcuts to set/get property", "[property]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Test symbol lookup of types, properties and methods", "[type]")
+{
+    static const symbol type_name("type_prop_invoke_test");
+    static const symbol p1_name("p1");
+    static const symbol p2_name("p2");
+    static const symbol method_name("get_p1");
+    static const symbol unknown_name("unknown");
+
+    const type t = type::get_by_name(type_name);
+    REQUIRE(t == type::get<type_prop_invoke_test>());
+    CHECK(type::get_by_name(unknown_name).is_valid() == false);
+    CHECK(type::get_by_name(symbol()).is_valid() == false);
+
+    // own and inherited items
+    CHECK(t.get_property(p2_name) == t.get_property("p2"));
+    CHECK(t.get_property(p1_name) == t.get_property("p1"));
+    CHECK(t.get_property(p1_name).is_valid() == true);
+    CHECK(t.get_property(unknown_name).is_valid() == false);
+
+    CHECK(type::get<type_prop_invoke_test_base>().get_property(p2_name).is_valid() == false);
+
+    const type base_t = type::get<type_prop_invoke_test_base>();
+    method meth = base_t.get_method(method_name);
+    REQUIRE(meth.is_valid() == true);
+    CHECK(meth == base_t.get_method("get_p1"));
+    type_prop_invoke_test_base obj;
+    CHECK(meth.invoke(obj).get_value<int>() == 12);
+    CHECK(base_t.get_method(p1_name).is_valid() == false);
+
+    // non class types
+    CHECK(type::get<int>().get_property(p1_name).is_valid() == false);
+    CHECK(type::get<int>().get_method(method_name).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("Test hashed_name lookup of types, properties and methods", "[type]")
+{
+    static RTTR_CONSTEXPR_OR_CONST hashed_name p1_name("p1");
+    static_assert(hashed_name("get_p1").get_hash() == detail::generate_hash_constexpr("get_p1", 6), "hash must be a constant expression");
+    CHECK(p1_name.get_hash() == detail::generate_hash("p1", 2));
+    CHECK(hashed_name(string_view("p1")).get_hash() == p1_name.get_hash());
+    CHECK(p1_name.str() == "p1");
+
+    // non ASCII characters must have the same hash at compile time and at runtime
+    CHECK(hashed_name("\xC3\xA4").get_hash() == detail::generate_hash("\xC3\xA4", 2));
+
+    const type t = type::get_by_name("type_prop_invoke_test");
+    REQUIRE(t == type::get<type_prop_invoke_test>());
+    CHECK(type::get_by_name(hashed_name("type_prop_invoke_test_base")) == type::get<type_prop_invoke_test_base>());
+    CHECK(type::get_by_name(hashed_name("unknown")).is_valid() == false);
+
+    CHECK(t.get_property(p1_name) == t.get_property(string_view("p1")));
+    CHECK(t.get_property(hashed_name("p2")).is_valid() == true);
+    CHECK(t.get_property(hashed_name("p3")).is_valid() == false);
+
+    const type base_t = type::get<type_prop_invoke_test_base>();
+    CHECK(base_t.get_method(hashed_name("get_p1")) == base_t.get_method(symbol("get_p1")));
+    CHECK(base_t.get_method(hashed_name("p1")).is_valid() == false);
+
+    // a char buffer uses only the characters up to the null terminator
+    char buffer[16] = "p2";
+    CHECK(t.get_property(hashed_name(buffer)).is_valid() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
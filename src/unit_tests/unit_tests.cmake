@@ -36,7 +36,13 @@ set(SOURCE_FILES main.cpp
                  misc/test_misc.cpp
                  misc/array_range_test.cpp
                  misc/string_view_test.cpp
+                 misc/interned_string_test.cpp
                  misc/enum_flags_test.cpp
+                 misc/sorted_vector_map_test.cpp
+                 misc/flat_hash_map_test.cpp
+                 misc/registration_statistics_test.cpp
+                 misc/registration_profiler_test.cpp
+                 misc/hot_path_counters_test.cpp
                  property/property_access_level_test.cpp
                  property/property_misc_test.cpp
                  property/property_class_inheritance.cpp
@@ -168,3 +168,88 @@ TEST_CASE("variant::operator=() - self assignment", "[variant]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::operator=() - same type", "[variant]")
+{
+    SECTION("reuse storage - value")
+    {
+        variant a = std::string("Hello World, this text is too long for a small string buffer");
+        const std::string* storage = &a.get_value<std::string>();
+
+        a = std::string("other text");
+        CHECK(&a.get_value<std::string>() == storage);
+        CHECK(a.get_value<std::string>() == "other text");
+
+        a = 42;
+        REQUIRE(a.is_type<int>() == true);
+        a = 23;
+        CHECK(a.get_value<int>() == 23);
+    }
+
+    SECTION("reuse storage - variant")
+    {
+        variant a = std::string("Hello World, this text is too long for a small string buffer");
+        const variant b = std::string("other text");
+        const std::string* storage = &a.get_value<std::string>();
+
+        a = b;
+        CHECK(&a.get_value<std::string>() == storage);
+        CHECK(a.get_value<std::string>() == "other text");
+        CHECK(b.get_value<std::string>() == "other text");
+    }
+
+    SECTION("not copy assignable type")
+    {
+        big_type obj;
+        variant a = obj;
+        const variant b = big_type();
+
+        a = b;
+        CHECK(a.is_type<big_type>() == true);
+        CHECK(b.is_type<big_type>() == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant::emplace()", "[variant]")
+{
+    SECTION("arithmetic type")
+    {
+        variant var;
+        int& value = var.emplace<int>(42);
+        REQUIRE(var.is_type<int>() == true);
+        CHECK(var.get_value<int>() == 42);
+
+        value = 23;
+        CHECK(var.get_value<int>() == 23);
+
+        var.emplace<double>();
+        REQUIRE(var.is_type<double>() == true);
+        CHECK(var.get_value<double>() == 0.0);
+    }
+
+    SECTION("std::string")
+    {
+        variant var = 12;
+        std::string& text = var.emplace<std::string>(5, 'a');
+        REQUIRE(var.is_type<std::string>() == true);
+        CHECK(var.get_value<std::string>() == "aaaaa");
+        CHECK(&text == &var.get_value<std::string>());
+    }
+
+    SECTION("custom type")
+    {
+        variant var = std::string("text");
+        big_type& obj = var.emplace<big_type>();
+        REQUIRE(var.is_type<big_type>() == true);
+        CHECK(&obj == &var.get_value<big_type>());
+        CHECK(obj.moved == false);
+
+        simple_type& small_obj = var.emplace<simple_type>();
+        REQUIRE(var.is_type<simple_type>() == true);
+        CHECK(small_obj.moved == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 
 #include <catch/catch.hpp>
 
+#include "unit_tests/variant/test_enums.h"
 #include <rttr/registration>
 
 using namespace rttr;
@@ -74,6 +75,16 @@ static vector2d convert_to_vector(const point& p, bool& ok)
     return vector2d(p._x, p._y);
 }
 
+static point convert_to_point(const std::string& text, bool& ok)
+{
+    const auto pos = text.find(',');
+    ok = (pos != std::string::npos);
+    if (!ok)
+        return point(0, 0);
+
+    return point(std::stoi(text.substr(0, pos)), std::stoi(text.substr(pos + 1)));
+}
+
 struct base
 {
     int dummy;
@@ -98,6 +109,7 @@ RTTR_REGISTRATION
 {
     type::register_converter_func(convert_to_string);
     type::register_converter_func(convert_to_vector);
+    type::register_converter_func(convert_to_point);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -290,7 +302,7 @@ TEST_CASE("variant conversion - to std::string", "[variant]")
         CHECK(var.to_string() == "1.567");
 
         var = 3.12345678f;
-        CHECK(var.to_string() == "3.12346");
+        CHECK(var.to_string() == "3.1234567");
 
         var = 0.0f;
         CHECK(var.to_string() == "0");
@@ -671,3 +683,69 @@ TEST_CASE("variant test - convert from wrapped value", "[variant]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant test - convert_from_chars", "[variant]")
+{
+    SECTION("to arithmetic types")
+    {
+        const std::string csv = "42,-3.5,true,300";
+        const string_view text(csv);
+
+        variant var = variant::convert_from_chars(string_view(text.data(), 2), type::get<int>());
+        REQUIRE(var.is_type<int>() == true);
+        CHECK(var.get_value<int>() == 42);
+
+        var = variant::convert_from_chars(string_view(text.data() + 3, 4), type::get<double>());
+        REQUIRE(var.is_type<double>() == true);
+        CHECK(var.get_value<double>() == -3.5);
+
+        var = variant::convert_from_chars(string_view(text.data() + 8, 4), type::get<bool>());
+        REQUIRE(var.is_type<bool>() == true);
+        CHECK(var.get_value<bool>() == true);
+
+        var = variant::convert_from_chars(string_view(text.data() + 13, 3), type::get<uint16_t>());
+        REQUIRE(var.is_type<uint16_t>() == true);
+        CHECK(var.get_value<uint16_t>() == 300);
+
+        var = variant::convert_from_chars(" FaLsE ", type::get<bool>());
+        REQUIRE(var.is_type<bool>() == true);
+        CHECK(var.get_value<bool>() == false);
+    }
+
+    SECTION("to std::string")
+    {
+        variant var = variant::convert_from_chars(string_view("hello world", 5), type::get<std::string>());
+        REQUIRE(var.is_type<std::string>() == true);
+        CHECK(var.get_value<std::string>() == "hello");
+    }
+
+    SECTION("to enumeration")
+    {
+        variant var = variant::convert_from_chars("VALUE_1", type::get<variant_enum_test>());
+        REQUIRE(var.is_type<variant_enum_test>() == true);
+        CHECK(var.get_value<variant_enum_test>() == variant_enum_test::VALUE_1);
+
+        CHECK(variant::convert_from_chars("NOT_A_VALUE", type::get<variant_enum_test>()).is_valid() == false);
+    }
+
+    SECTION("to custom type")
+    {
+        variant var = variant::convert_from_chars("12,34", type::get<point>());
+        REQUIRE(var.is_type<point>() == true);
+        CHECK(var.get_value<point>() == point(12, 34));
+
+        CHECK(variant::convert_from_chars("12", type::get<point>()).is_valid() == false);
+    }
+
+    SECTION("invalid conversion")
+    {
+        CHECK(variant::convert_from_chars("42abc", type::get<int>()).is_valid() == false);
+        CHECK(variant::convert_from_chars("300", type::get<uint8_t>()).is_valid() == false);
+        CHECK(variant::convert_from_chars("1.5", type::get<int>()).is_valid() == false);
+        CHECK(variant::convert_from_chars("", type::get<double>()).is_valid() == false);
+        CHECK(variant::convert_from_chars("42", type::get<vector2d>()).is_valid() == false);
+        CHECK(variant::convert_from_chars("42", type::get_by_name("not existing type")).is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
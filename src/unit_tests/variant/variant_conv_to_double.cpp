@@ -122,6 +122,26 @@ TEST_CASE("variant::to_double() - from std::string", "[variant]")
         CHECK(var.convert(type::get<double>()) == true);
     }
 
+    SECTION("scientific notation")
+    {
+        variant var = std::string("1.5e3");
+        bool ok = false;
+        CHECK(var.to_double(&ok) == 1500.0);
+        CHECK(ok == true);
+
+        var = std::string("  -2.5E-2");
+        CHECK(var.to_double(&ok) == -0.025);
+        CHECK(ok == true);
+
+        var = std::string("1.7976931348623157e+308");
+        CHECK(var.to_double(&ok) == std::numeric_limits<double>::max());
+        CHECK(ok == true);
+
+        var = std::string("1e");
+        CHECK(var.to_double(&ok) == 0.0);
+        CHECK(ok == false);
+    }
+
     SECTION("too big")
     {
         variant var = std::string("1.79769e+309");
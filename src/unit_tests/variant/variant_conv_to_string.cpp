@@ -161,18 +161,18 @@ TEST_CASE("variant::to_string() - from float", "[variant]")
         variant var = 214748.9f;
         REQUIRE(var.can_convert<std::string>() == true);
         bool ok = false;
-        CHECK(var.to_string(&ok) == "214749");
+        CHECK(var.to_string(&ok) == "214748.9");
         CHECK(ok == true);
 
         REQUIRE(var.convert(type::get<std::string>()) == true);
-        CHECK(var.get_value<std::string>() == "214749");
+        CHECK(var.get_value<std::string>() == "214748.9");
     }
 
     SECTION("conversion negative")
     {
         variant var = -214748.9f;
         bool ok = false;
-        CHECK(var.to_string(&ok) == "-214749");
+        CHECK(var.to_string(&ok) == "-214748.9");
         CHECK(ok == true);
         CHECK(var.convert(type::get<std::string>()) == true);
     }
@@ -202,6 +202,23 @@ TEST_CASE("variant::to_string() - from double", "[variant]")
         CHECK(ok == true);
         CHECK(var.convert(type::get<std::string>()) == true);
     }
+
+    SECTION("round trip")
+    {
+        variant var = 0.1;
+        CHECK(var.to_string() == "0.1");
+
+        var = 1.0 / 3.0;
+        CHECK(var.to_string() == "0.3333333333333333");
+        var = var.to_string();
+        CHECK(var.to_double() == 1.0 / 3.0);
+
+        var = 1e300;
+        CHECK(var.to_string() == "1e+300");
+
+        var = 0.00001;
+        CHECK(var.to_string() == "1e-05");
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,8 @@
 
 #include <vector>
 #include <map>
+#include <list>
+#include <array>
 #include <string>
 
 using namespace rttr;
@@ -104,6 +106,25 @@ TEST_CASE("variant_array_view::ctor", "[variant_array_view]")
         variant_array_view b(a);
         CHECK(b.is_valid() == true);
    }
+
+   SECTION("copy refers to the same array")
+   {
+        std::vector<int> vec = {1, 2, 3};
+        variant var = std::ref(vec);
+        variant_array_view a = var.create_array_view();
+        variant_array_view b(a);
+        variant_array_view c(std::move(a));
+
+        CHECK(b.set_value(0, 23) == true);
+        CHECK(c.get_value(0).to_int() == 23);
+        CHECK(vec[0] == 23);
+
+        variant_array_view d;
+        d = c;
+        CHECK(d.insert_value(3, 42) == true);
+        CHECK(b.get_size() == 4);
+        CHECK(vec.back() == 42);
+   }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -212,6 +233,85 @@ TEST_CASE("variant_array_view::swap", "[variant_array_view]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant_array_view::get_contiguous_data", "[variant_array_view]")
+{
+   SECTION("empty")
+   {
+        variant_array_view a;
+        CHECK(a.is_contiguous() == false);
+
+        auto data = a.get_contiguous_data();
+        CHECK(data.data == nullptr);
+        CHECK(data.size == 0);
+        CHECK(data.element_size == 0);
+        CHECK(data.element_type.is_valid() == false);
+   }
+
+   SECTION("std::vector")
+   {
+        std::vector<float> vec = {1.0f, 2.0f, 3.0f};
+        variant var = std::ref(vec);
+        variant_array_view a = var.create_array_view();
+        CHECK(a.is_contiguous() == true);
+
+        auto data = a.get_contiguous_data();
+        CHECK(data.data == vec.data());
+        CHECK(data.size == 3);
+        CHECK(data.element_size == sizeof(float));
+        CHECK(data.element_type == type::get<float>());
+        CHECK(data.is_read_only == false);
+
+        static_cast<float*>(data.data)[1] = 42.0f;
+        CHECK(vec[1] == 42.0f);
+   }
+
+   SECTION("const std::vector")
+   {
+        const std::vector<int> vec = {1, 2, 3};
+        variant var = &vec;
+        auto data = var.create_array_view().get_contiguous_data();
+        CHECK(data.data == vec.data());
+        CHECK(data.is_read_only == true);
+   }
+
+   SECTION("raw array")
+   {
+        int array[2][4] = {{1, 2, 3, 4}, {5, 6, 7, 8}};
+        variant var = &array;
+        auto data = var.create_array_view().get_contiguous_data();
+        CHECK(data.data == &array[0]);
+        CHECK(data.size == 2);
+        CHECK(data.element_size == sizeof(int[4]));
+        CHECK((data.element_type == type::get<int[4]>()));
+   }
+
+   SECTION("std::array")
+   {
+        std::array<double, 5> array = {};
+        variant var = &array;
+        auto data = var.create_array_view().get_contiguous_data();
+        CHECK(data.data == array.data());
+        CHECK(data.size == 5);
+        CHECK(data.element_type == type::get<double>());
+   }
+
+   SECTION("not contiguous")
+   {
+        std::list<int> list = {1, 2, 3};
+        variant var = std::ref(list);
+        variant_array_view a = var.create_array_view();
+        CHECK(a.is_valid() == true);
+        CHECK(a.is_contiguous() == false);
+        CHECK(a.get_contiguous_data().data == nullptr);
+
+        std::vector<bool> bool_vec = {true, false};
+        var = std::ref(bool_vec);
+        CHECK(var.create_array_view().is_contiguous() == false);
+   }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant_array_view::is_dynamic", "[variant_array_view]")
 {
     SECTION("static")
@@ -509,6 +609,183 @@ TEST_CASE("variant_array_view::set_size", "[variant_array_view]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant_array_view::reserve", "[variant_array_view]")
+{
+   SECTION("std::vector")
+   {
+        std::vector<int> vec;
+        variant var = std::ref(vec);
+        variant_array_view a = var.create_array_view();
+        CHECK(a.reserve(100) == true);
+        CHECK(vec.capacity() >= 100);
+        CHECK(vec.empty() == true);
+   }
+
+   SECTION("not supported")
+   {
+        std::list<int> list;
+        variant var = std::ref(list);
+        CHECK(var.create_array_view().reserve(100) == false);
+
+        const std::vector<int> vec;
+        var = &vec;
+        CHECK(var.create_array_view().reserve(100) == false);
+
+        variant_array_view a;
+        CHECK(a.reserve(100) == false);
+   }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::assign", "[variant_array_view]")
+{
+   std::vector<variant> values = {1, 2, 3};
+   std::vector<argument> args(values.begin(), values.end());
+   array_range<argument> range(args.data(), args.size());
+
+   SECTION("std::vector")
+   {
+        std::vector<int> vec = {23, 42, 5, 5, 5};
+        variant var = std::ref(vec);
+        variant_array_view a = var.create_array_view();
+        CHECK(a.assign(range) == true);
+        CHECK((vec == std::vector<int>{1, 2, 3}));
+   }
+
+   SECTION("std::list")
+   {
+        std::list<int> list;
+        variant var = std::ref(list);
+        CHECK(var.create_array_view().assign(range) == true);
+        CHECK((list == std::list<int>{1, 2, 3}));
+   }
+
+   SECTION("static array")
+   {
+        int array[3] = {0, 0, 0};
+        variant var = &array;
+        CHECK(var.create_array_view().assign(range) == true);
+        CHECK(array[2] == 3);
+
+        int array_2[2] = {0, 0};
+        var = &array_2;
+        CHECK(var.create_array_view().assign(range) == false);
+   }
+
+   SECTION("invalid type")
+   {
+        std::vector<variant> mixed_values = {1, 2.0, 3};
+        std::vector<argument> mixed_args(mixed_values.begin(), mixed_values.end());
+
+        std::vector<int> vec = {23};
+        variant var = std::ref(vec);
+        CHECK(var.create_array_view().assign(array_range<argument>(mixed_args.data(), mixed_args.size())) == false);
+        CHECK((vec == std::vector<int>{23}));
+   }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::append_range", "[variant_array_view]")
+{
+   std::vector<variant> values = {1, 2, 3};
+   std::vector<argument> args(values.begin(), values.end());
+   array_range<argument> range(args.data(), args.size());
+
+   SECTION("std::vector")
+   {
+        std::vector<int> vec = {0};
+        variant var = std::ref(vec);
+        variant_array_view a = var.create_array_view();
+        CHECK(a.append_range(range) == true);
+        CHECK(a.append_range(range) == true);
+        CHECK((vec == std::vector<int>{0, 1, 2, 3, 1, 2, 3}));
+   }
+
+   SECTION("std::list")
+   {
+        std::list<int> list = {0};
+        variant var = std::ref(list);
+        CHECK(var.create_array_view().append_range(range) == true);
+        CHECK((list == std::list<int>{0, 1, 2, 3}));
+   }
+
+   SECTION("static array")
+   {
+        std::array<int, 3> array = {};
+        variant var = &array;
+        CHECK(var.create_array_view().append_range(range) == false);
+   }
+
+   SECTION("multi dimensional")
+   {
+        std::vector<std::vector<int>> vec;
+        std::vector<int> sub_vec = {1, 2};
+        variant sub_var = sub_vec;
+        argument sub_arg = sub_var;
+        variant var = std::ref(vec);
+        CHECK(var.create_array_view().append_range(array_range<argument>(&sub_arg, 1)) == true);
+        REQUIRE(vec.size() == 1);
+        CHECK(vec[0] == sub_vec);
+   }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::assign_from", "[variant_array_view]")
+{
+   const float values[] = {1.0f, 2.0f, 3.0f};
+
+   SECTION("std::vector")
+   {
+        std::vector<float> vec;
+        variant var = std::ref(vec);
+        variant_array_view a = var.create_array_view();
+        CHECK(a.assign_from(values, 3) == true);
+        CHECK((vec == std::vector<float>{1.0f, 2.0f, 3.0f}));
+
+        const double double_values[] = {1.0};
+        CHECK(a.assign_from(double_values, 1) == false);
+        CHECK(vec.size() == 3);
+   }
+
+   SECTION("std::list")
+   {
+        std::list<float> list = {5.0f};
+        variant var = std::ref(list);
+        CHECK(var.create_array_view().assign_from(values, 3) == true);
+        CHECK((list == std::list<float>{1.0f, 2.0f, 3.0f}));
+   }
+
+   SECTION("static array")
+   {
+        float array[3] = {};
+        variant var = &array;
+        CHECK(var.create_array_view().assign_from(values, 3) == true);
+        CHECK(array[1] == 2.0f);
+        CHECK(var.create_array_view().assign_from(values, 2) == false);
+   }
+
+   SECTION("std::vector<bool>")
+   {
+        const bool bool_values[] = {true, false, true};
+        std::vector<bool> vec;
+        variant var = std::ref(vec);
+        CHECK(var.create_array_view().assign_from(bool_values, 3) == true);
+        CHECK((vec == std::vector<bool>{true, false, true}));
+   }
+
+   SECTION("const array")
+   {
+        const std::vector<float> vec;
+        variant var = &vec;
+        CHECK(var.create_array_view().assign_from(values, 3) == false);
+   }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant_array_view::get_value", "[variant_array_view]")
 {
     SECTION("empty")
@@ -831,6 +1108,92 @@ TEST_CASE("variant_array_view::remove_value", "[variant_array_view]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant_array_view::fixed index list", "[variant_array_view]")
+{
+    std::vector<std::vector<std::vector<int>>> vec(2, std::vector<std::vector<int>>(3, std::vector<int>(4, 0)));
+    variant var = std::ref(vec);
+    variant_array_view a = var.create_array_view();
+
+    CHECK(a.get_size_variadic(std::array<std::size_t, 0>{}) == 2);
+    CHECK(a.get_size_variadic(std::array<std::size_t, 1>{{1}}) == 3);
+    CHECK(a.get_size_variadic(std::array<std::size_t, 2>{{1, 2}}) == 4);
+
+    CHECK(a.set_value_variadic(std::array<std::size_t, 3>{{1, 2, 3}}, 42) == true);
+    CHECK(vec[1][2][3] == 42);
+    CHECK(a.get_value_variadic(std::array<std::size_t, 3>{{1, 2, 3}}).to_int() == 42);
+    CHECK(a.get_value_variadic(std::array<std::size_t, 4>{{1, 2, 3, 0}}).is_valid() == false);
+
+    CHECK(a.set_size_variadic(5, std::array<std::size_t, 2>{{0, 0}}) == true);
+    CHECK(vec[0][0].size() == 5);
+
+    CHECK(a.insert_value_variadic(std::array<std::size_t, 3>{{0, 0, 0}}, 23) == true);
+    CHECK(vec[0][0].size() == 6);
+    CHECK(vec[0][0][0] == 23);
+
+    CHECK(a.remove_value_variadic(std::array<std::size_t, 3>{{0, 0, 0}}) == true);
+    CHECK(vec[0][0].size() == 5);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_array_view::get_flat_value", "[variant_array_view]")
+{
+    SECTION("raw array")
+    {
+        float array[4][4][16] = {};
+        variant var = &array;
+        variant_array_view a = var.create_array_view();
+
+        REQUIRE(a.get_flat_size() == 256);
+        CHECK(a.set_flat_value(1 * 64 + 2 * 16 + 3, 1.5f) == true);
+        CHECK(array[1][2][3] == 1.5f);
+        CHECK(a.get_flat_value(1 * 64 + 2 * 16 + 3).get_value<float>() == 1.5f);
+
+        CHECK(a.set_flat_value(0, 2.0) == false);
+        CHECK(a.set_flat_value(256, 1.0f) == false);
+        CHECK(a.get_flat_value(256).is_valid() == false);
+    }
+
+    SECTION("std::array")
+    {
+        std::array<std::array<int, 3>, 2> array = {};
+        variant var = &array;
+        variant_array_view a = var.create_array_view();
+
+        REQUIRE(a.get_flat_size() == 6);
+        CHECK(a.set_flat_value(4, 42) == true);
+        CHECK(array[1][1] == 42);
+    }
+
+    SECTION("const array")
+    {
+        const int array[2][2] = {{1, 2}, {3, 4}};
+        variant var = &array;
+        variant_array_view a = var.create_array_view();
+
+        REQUIRE(a.get_flat_size() == 4);
+        CHECK(a.get_flat_value(3).get_value<int>() == 4);
+        CHECK(a.set_flat_value(3, 5) == false);
+    }
+
+    SECTION("not flat")
+    {
+        std::vector<std::vector<int>> vec(2, std::vector<int>(2, 0));
+        variant var = std::ref(vec);
+        variant_array_view a = var.create_array_view();
+
+        CHECK(a.get_flat_size() == 0);
+        CHECK(a.get_flat_value(0).is_valid() == false);
+        CHECK(a.set_flat_value(0, 1) == false);
+
+        std::array<std::vector<int>, 2> array_of_vec;
+        var = &array_of_vec;
+        CHECK(var.create_array_view().get_flat_size() == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant_array_view::get_value_as_ref", "[variant_array_view]")
 {
     SECTION("positiv test")
@@ -876,6 +1239,84 @@ TEST_CASE("variant_array_view::get_value_as_ref", "[variant_array_view]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant_array_view::begin/end", "[variant_array_view]")
+{
+   SECTION("empty")
+   {
+        variant_array_view a;
+        CHECK((a.begin() == a.end()));
+   }
+
+   SECTION("std::list")
+   {
+        std::list<int> list = {1, 2, 3};
+        variant var = std::ref(list);
+        variant_array_view a = var.create_array_view();
+
+        int sum = 0;
+        for (const auto& item : a)
+        {
+            REQUIRE((item.get_type() == type::get<std::reference_wrapper<int>>()));
+            sum += item.get_wrapped_value<int>();
+        }
+        CHECK(sum == 6);
+
+        auto itr = a.begin();
+        CHECK(a.set_value(itr, 42) == true);
+        CHECK(a.set_value(itr, 42.0) == false);
+        auto itr_2 = itr++;
+        CHECK((*itr_2).get_wrapped_value<int>() == 42);
+        CHECK(itr.get_value().get_wrapped_value<int>() == 2);
+        CHECK(list.front() == 42);
+   }
+
+   SECTION("std::vector<bool>")
+   {
+        std::vector<bool> vec = {true, false};
+        variant var = std::ref(vec);
+        variant_array_view a = var.create_array_view();
+
+        auto itr = a.begin();
+        CHECK((*itr).get_value<bool>() == true);
+        CHECK(a.set_value(++itr, true) == true);
+        CHECK(vec[1] == true);
+        CHECK((++itr == a.end()));
+   }
+
+   SECTION("const array")
+   {
+        const std::vector<int> vec = {1, 2};
+        variant var = &vec;
+        variant_array_view a = var.create_array_view();
+
+        auto itr = a.begin();
+        CHECK((itr.get_value().get_type() == type::get<std::reference_wrapper<const int>>()));
+        CHECK(a.set_value(itr, 5) == false);
+   }
+
+   SECTION("multi dimensional raw array")
+   {
+        int array[2][3] = {{1, 2, 3}, {4, 5, 6}};
+        variant var = &array;
+        variant_array_view a = var.create_array_view();
+
+        int sum = 0;
+        for (const auto& item : a)
+        {
+            auto sub_array = item.create_array_view();
+            for (const auto& sub_item : sub_array)
+                sum += sub_item.get_wrapped_value<int>();
+        }
+        CHECK(sum == 21);
+
+        int new_values[3] = {7, 8, 9};
+        CHECK(a.set_value(a.begin(), new_values) == true);
+        CHECK(array[0][2] == 9);
+   }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant_array_view::misc", "[variant_array_view]")
 {
     SECTION("check support of vector<bool>()")
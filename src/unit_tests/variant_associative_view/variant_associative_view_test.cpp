@@ -31,7 +31,9 @@
 
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
 
 using namespace rttr;
 using namespace std;
@@ -530,6 +532,143 @@ TEST_CASE("variant_associative_view::erase", "[variant_associative_view]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("variant_associative_view::find - converting key", "[variant_associative_view]")
+{
+    auto map = std::map<std::string, int>{ { "one", 1 }, { "two", 2 }, { "42", 3 } };
+    variant var = map;
+    auto view = var.create_associative_view();
+
+    SECTION("string_view")
+    {
+        auto itr = view.find(string_view("two"));
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_value().to_int() == 2);
+
+        CHECK(view.find(string_view("three")) == view.end());
+    }
+
+    SECTION("arithmetic")
+    {
+        auto itr = view.find(42);
+        REQUIRE(itr != view.end());
+        CHECK(itr.get_value().to_int() == 3);
+    }
+
+    SECTION("equal_range & erase")
+    {
+        auto range = view.equal_range(string_view("one"));
+        REQUIRE(range.first != view.end());
+        CHECK(range.first.get_value().to_int() == 1);
+
+        CHECK(view.erase(string_view("one")) == 1);
+        CHECK(view.get_size() == 2);
+    }
+
+    SECTION("not convertible")
+    {
+        auto set = std::set<int>{ 1, 2, 3 };
+        variant var_set = set;
+        auto set_view = var_set.create_associative_view();
+
+        CHECK(set_view.find(string_view("not a number")) == set_view.end());
+        CHECK(set_view.find(std::vector<int>(1, 1)) == set_view.end());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::insert_range", "[variant_associative_view]")
+{
+    SECTION("std::set")
+    {
+        variant var = std::set<int>{ 1 };
+        auto view = var.create_associative_view();
+
+        int k1 = 1, k2 = 2, k3 = 3;
+        std::vector<argument> keys = { k1, k2, k3 };
+        CHECK(view.insert_range(array_range<argument>(keys.data(), keys.size())) == 2);
+        CHECK(view.get_size() == 3);
+
+        // key-value insert is not possible for a set
+        CHECK(view.insert_range(array_range<argument>(keys.data(), keys.size()),
+                                array_range<argument>(keys.data(), keys.size())) == 0);
+    }
+
+    SECTION("std::unordered_map")
+    {
+        variant var = std::unordered_map<int, std::string>{};
+        auto view = var.create_associative_view();
+
+        int k1 = 1, k2 = 2, k3 = 3;
+        std::string v1 = "one", v2 = "two", v3 = "three";
+        std::vector<argument> keys = { k1, k2, k3 };
+        std::vector<argument> values = { v1, v2, v3 };
+
+        CHECK(view.insert_range(array_range<argument>(keys.data(), keys.size()),
+                                array_range<argument>(values.data(), values.size())) == 3);
+
+        auto& map = var.get_value<std::unordered_map<int, std::string>>();
+        CHECK(map.size() == 3);
+        CHECK(map.at(2) == "two");
+
+        // only keys are not enough for a map
+        CHECK(view.insert_range(array_range<argument>(keys.data(), keys.size())) == 0);
+    }
+
+    SECTION("type mismatch inserts nothing")
+    {
+        variant var = std::map<int, std::string>{};
+        auto view = var.create_associative_view();
+
+        int k1 = 1;
+        double k2 = 2.0;
+        std::string v1 = "one", v2 = "two";
+        std::vector<argument> keys = { k1, k2 };
+        std::vector<argument> values = { v1, v2 };
+
+        CHECK(view.insert_range(array_range<argument>(keys.data(), keys.size()),
+                                array_range<argument>(values.data(), values.size())) == 0);
+        CHECK(view.get_size() == 0);
+
+        // different size of keys and values
+        CHECK(view.insert_range(array_range<argument>(keys.data(), 1),
+                                array_range<argument>(values.data(), 2)) == 0);
+        CHECK(view.get_size() == 0);
+    }
+
+    SECTION("const container")
+    {
+        auto set = std::set<int>{};
+        variant var = std::cref(set);
+        auto view = var.create_associative_view();
+
+        int k1 = 1, k2 = 2;
+        std::vector<argument> keys = { k1, k2 };
+        CHECK(view.insert_range(array_range<argument>(keys.data(), keys.size())) == 0);
+        CHECK(set.empty() == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::reserve", "[variant_associative_view]")
+{
+    variant var = std::unordered_map<int, int>{};
+    auto view = var.create_associative_view();
+
+    CHECK(view.reserve(100) == true);
+    using map_type = std::unordered_map<int, int>;
+    CHECK(var.get_value<map_type>().bucket_count() >= 100);
+
+    variant var_map = std::map<int, int>{};
+    CHECK(var_map.create_associative_view().reserve(100) == false);
+
+    variant var_empty;
+    CHECK(var_empty.create_associative_view().reserve(100) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("variant_associative_view::clear", "[variant_associative_view]")
 {
     SECTION("std::set")
@@ -619,3 +758,52 @@ TEST_CASE("variant_associative_view::begin/end", "[variant_associative_view]")
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("variant_associative_view::const_iterator - get_key_ref/get_value_ref", "[variant_associative_view]")
+{
+    SECTION("std::map")
+    {
+        auto map = std::map<int, std::string>{ { 1, "one" }, { 2, "two" } };
+        variant var = std::ref(map);
+        auto view = var.create_associative_view();
+
+        auto itr = view.begin();
+        auto key = itr.get_key_ref();
+        auto value = itr.get_value_ref();
+
+        REQUIRE(key.is_valid() == true);
+        REQUIRE(value.is_valid() == true);
+        CHECK(key.get_type() == type::get<int>());
+        CHECK(value.get_type() == type::get<std::string>());
+
+        // no copy, the instance refers to the element inside the container
+        CHECK(key.try_convert<int>() == &map.begin()->first);
+        CHECK(value.try_convert<std::string>() == &map.begin()->second);
+
+        *value.try_convert<std::string>() = "ONE";
+        CHECK(map[1] == "ONE");
+    }
+
+    SECTION("std::set")
+    {
+        auto set = std::set<int>{ 23 };
+        variant var = std::ref(set);
+        auto view = var.create_associative_view();
+
+        auto itr = view.begin();
+        CHECK(itr.get_key_ref().try_convert<int>() == &*set.begin());
+        CHECK(itr.get_value_ref().is_valid() == false);
+    }
+
+    SECTION("invalid")
+    {
+        variant var;
+        auto view = var.create_associative_view();
+        auto itr = view.begin();
+
+        CHECK(itr.get_key_ref().is_valid() == false);
+        CHECK(itr.get_value_ref().is_valid() == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////